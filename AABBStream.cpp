@@ -0,0 +1,96 @@
+//
+#include "AABBStream.hpp"
+#include <cstring> // memcpy(), memset()
+#include <utility> // std::swap()
+
+//
+AABBStream::AABBStream(const AABB* pArr_, const size_t size_)
+{
+	Reserve(size_);
+	for (size_t i{ 0 }; i < size_; ++i)
+	{ Set(i, pArr_[i]); }
+	size = size_;
+}
+
+//
+AABBStream::AABBStream(const AABBStream& rhs_)
+{
+	Reserve(rhs_.size);
+	if (rhs_.size)
+	{
+		memcpy(min_x, rhs_.min_x, rhs_.size * sizeof(float));
+		memcpy(min_y, rhs_.min_y, rhs_.size * sizeof(float));
+		memcpy(max_x, rhs_.max_x, rhs_.size * sizeof(float));
+		memcpy(max_y, rhs_.max_y, rhs_.size * sizeof(float));
+	}
+	size = rhs_.size;
+}
+
+//
+AABBStream::AABBStream(AABBStream&& rhs_) noexcept
+{ Swap(rhs_); }
+
+//
+AABBStream::~AABBStream()
+{ SIMDAlignedFree(min_x); }
+
+//
+AABBStream& AABBStream::operator=(AABBStream rhs_)
+{
+	// copy swap idiom
+	Swap(rhs_);
+	return *this;
+}
+
+//
+void AABBStream::Reserve(const size_t capacity_)
+{
+	if (capacity_ <= capacity)
+	{ return; }
+
+	// the four arrays share one block, each starts right after the last one's padding
+	const size_t padded = SIMDPaddedSize(capacity_);
+	float* block = static_cast<float*>(SIMDAlignedAlloc(4 * padded * sizeof(float)));
+	memset(block, 0, 4 * padded * sizeof(float));
+	if (size)
+	{
+		memcpy(block, min_x, size * sizeof(float));
+		memcpy(block + padded, min_y, size * sizeof(float));
+		memcpy(block + 2 * padded, max_x, size * sizeof(float));
+		memcpy(block + 3 * padded, max_y, size * sizeof(float));
+	}
+	SIMDAlignedFree(min_x);
+	min_x = block;
+	min_y = block + padded;
+	max_x = block + 2 * padded;
+	max_y = block + 3 * padded;
+	capacity = padded;
+}
+
+//
+void AABBStream::PushBack(const AABB& aabb_)
+{
+	if (size == capacity)
+	{ Reserve(capacity ? capacity * 2 : SIMD_WIDTH); }
+	Set(size++, aabb_);
+}
+
+//
+void AABBStream::Clear()
+{
+	// zero what was in use so the padding stays zero
+	for (size_t f{ 0 }; f < 4 && size; ++f)
+	{ memset(min_x + f * capacity, 0, size * sizeof(float)); }
+	size = 0;
+}
+
+//
+void AABBStream::Swap(AABBStream& rhs_) noexcept
+{
+	std::swap(min_x, rhs_.min_x);
+	std::swap(min_y, rhs_.min_y);
+	std::swap(max_x, rhs_.max_x);
+	std::swap(max_y, rhs_.max_y);
+	std::swap(size, rhs_.size);
+	std::swap(capacity, rhs_.capacity);
+}
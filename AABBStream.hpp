@@ -0,0 +1,76 @@
+//
+#pragma once
+#ifndef AABB_STREAM_HPP_
+#define AABB_STREAM_HPP_
+
+#include "SIMD.hpp"
+#include "Types.hpp"
+
+// structure-of-arrays AABB storage for broadphase and query loops. Like
+// Vec2Stream all four arrays share one SIMD_ALIGNMENT aligned block, zero
+// padded to a multiple of SIMD_WIDTH.
+struct AABBStream
+{
+	float* min_x{ nullptr };
+	float* min_y{ nullptr };
+	float* max_x{ nullptr };
+	float* max_y{ nullptr };
+
+	/* Constructors */
+
+	//
+	AABBStream() = default;
+
+	//
+	AABBStream(const AABB* pArr_, size_t size_);
+
+	//
+	AABBStream(const AABBStream& rhs_);
+
+	//
+	AABBStream(AABBStream&& rhs_) noexcept;
+
+	//
+	~AABBStream();
+
+	/* Assignment Operators */
+
+	//
+	AABBStream& operator=(AABBStream rhs_);
+
+	/* Others */
+
+	//
+	size_t Size() const
+	{ return size; }
+
+	//
+	size_t Capacity() const
+	{ return capacity; }
+
+	//
+	AABB Get(size_t i_) const
+	{ return { { min_x[i_], min_y[i_] }, { max_x[i_], max_y[i_] } }; }
+
+	//
+	void Set(size_t i_, const AABB& aabb_)
+	{ min_x[i_] = aabb_.min.x; min_y[i_] = aabb_.min.y; max_x[i_] = aabb_.max.x; max_y[i_] = aabb_.max.y; }
+
+	//
+	void Reserve(size_t capacity_);
+
+	// takes a Rect as well, through AABB(rect_)
+	void PushBack(const AABB& aabb_);
+
+	//
+	void Clear();
+
+	//
+	void Swap(AABBStream& rhs_) noexcept;
+
+private:
+	size_t size{ 0 };
+	size_t capacity{ 0 };
+};
+
+#endif // AABB_STREAM_HPP_
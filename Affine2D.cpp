@@ -0,0 +1,132 @@
+//
+#include "Affine2D.hpp"
+#include <algorithm> // std::swap()
+#include <corecrt_math_defines.h> // M_PI
+
+constexpr float EPSILON = 0.0001f;
+
+//
+Affine2D::Affine2D(const float* pArr_)
+{
+	for (size_t i{ 0 }; i < 6; ++i)
+	{ m[i] = *(pArr_ + i); }
+}
+
+//
+Affine2D::Affine2D(const float a00_, const float a01_, const float a02_,
+	const float a10_, const float a11_, const float a12_)
+{
+	a00 = a00_; a01 = a01_; a02 = a02_;
+	a10 = a10_; a11 = a11_; a12 = a12_;
+}
+
+//
+Affine2D::Affine2D(const Matrix3x3& mtx_)
+{
+	if (mtx_.a20 < -EPSILON || EPSILON < mtx_.a20 ||
+		mtx_.a21 < -EPSILON || EPSILON < mtx_.a21 ||
+		mtx_.a22 < 1 - EPSILON || 1 + EPSILON < mtx_.a22)
+	{ throw "Matrix3x3 is not affine in Affine2D()"; }
+
+	a00 = mtx_.a00; a01 = mtx_.a01; a02 = mtx_.a02;
+	a10 = mtx_.a10; a11 = mtx_.a11; a12 = mtx_.a12;
+}
+
+//
+Affine2D& Affine2D::operator*=(const Affine2D& rhs_)
+{ return *this = *this * rhs_; }
+
+//
+float Affine2D::Determinant() const
+{ return a00 * a11 - a01 * a10; }
+
+//
+void Affine2D::Swap(Affine2D& rhs_)
+{ std::swap((*this).m, rhs_.m); }
+
+//
+Affine2D operator*(const Affine2D& lhs_, const Affine2D& rhs_)
+{
+	// [L0 t0] * [L1 t1] = [L0 * L1, L0 * t1 + t0], the {0, 0, 1} row never enters
+	return
+	{
+		lhs_.a00 * rhs_.a00 + lhs_.a01 * rhs_.a10,
+		lhs_.a00 * rhs_.a01 + lhs_.a01 * rhs_.a11,
+		lhs_.a00 * rhs_.a02 + lhs_.a01 * rhs_.a12 + lhs_.a02,
+		lhs_.a10 * rhs_.a00 + lhs_.a11 * rhs_.a10,
+		lhs_.a10 * rhs_.a01 + lhs_.a11 * rhs_.a11,
+		lhs_.a10 * rhs_.a02 + lhs_.a11 * rhs_.a12 + lhs_.a12
+	};
+}
+
+//
+Vector2D operator*(const Affine2D& aff_, const Vector2D& rhs_)
+{
+	return
+	{
+		aff_.a00 * rhs_.x + aff_.a01 * rhs_.y + aff_.a02,
+		aff_.a10 * rhs_.x + aff_.a11 * rhs_.y + aff_.a12
+	};
+}
+
+//
+Vector2D Affine2DTransformVector(const Affine2D& aff_, const Vector2D& vec_)
+{
+	return
+	{
+		aff_.a00 * vec_.x + aff_.a01 * vec_.y,
+		aff_.a10 * vec_.x + aff_.a11 * vec_.y
+	};
+}
+
+//
+Matrix3x3 Mtx33FromAffine2D(const Affine2D& aff_)
+{
+	return
+	{
+		aff_.a00, aff_.a01, aff_.a02,
+		aff_.a10, aff_.a11, aff_.a12,
+		0, 0, 1
+	};
+}
+
+//
+Affine2D Affine2DIdentity()
+{ return { 1, 0, 0, 0, 1, 0 }; }
+
+//
+Affine2D Affine2DTranslate(const float x_, const float y_)
+{ return { 1, 0, x_, 0, 1, y_ }; }
+
+//
+Affine2D Affine2DScale(const float x_, const float y_)
+{ return { x_, 0, 0, 0, y_, 0 }; }
+
+//
+Affine2D Affine2DRotRad(const float radians_)
+{
+	const float c = cosf(radians_), s = sinf(radians_);
+	return { c, -s, 0, s, c, 0 };
+}
+
+//
+Affine2D Affine2DRotDeg(const float degrees_)
+{ return Affine2DRotRad(static_cast<float>(degrees_ / 180.0f * M_PI)); }
+
+//
+Affine2D Affine2DInverse(const Affine2D& aff_)
+{
+	const float determinant = aff_.Determinant();
+	if (-EPSILON <= determinant && determinant <= EPSILON)
+	{ throw "Determinant = 0 in Affine2DInverse()"; }
+
+	// [L t]^-1 = [L^-1, -L^-1 * t]
+	const float inv_det = 1.0f / determinant;
+	const float i00 = aff_.a11 * inv_det, i01 = -aff_.a01 * inv_det;
+	const float i10 = -aff_.a10 * inv_det, i11 = aff_.a00 * inv_det;
+	return
+	{
+		i00, i01, -(i00 * aff_.a02 + i01 * aff_.a12),
+		i10, i11, -(i10 * aff_.a02 + i11 * aff_.a12)
+	};
+}
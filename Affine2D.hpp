@@ -0,0 +1,85 @@
+//
+#pragma once
+#ifndef AFFINE2D_H_
+#define AFFINE2D_H_
+
+#include "Matrix3x3.hpp"
+
+// 2x3 affine transform, the implicit last row is always {0, 0, 1}
+typedef union Affine2D
+{
+	// some warning about a nameless struct
+	// but it's way more convenient this way :(
+	struct
+	{
+		float a00, a01, a02;
+		float a10, a11, a12;
+	};
+
+	float m[6]{};
+	float m2[2][3];
+
+	/* Constructors */
+
+	//
+	Affine2D() = default;
+
+	//
+	explicit Affine2D(const float* pArr_);
+
+	//
+	Affine2D(float a00_, float a01_, float a02_,
+		float a10_, float a11_, float a12_);
+
+	// throws if the last row of mtx_ is not {0, 0, 1}
+	explicit Affine2D(const Matrix3x3& mtx_);
+
+	/* Assignment operators */
+
+	//
+	Affine2D& operator=(const Affine2D& rhs_) = default;
+
+	//
+	Affine2D& operator*=(const Affine2D& rhs_);
+
+	/* Others */
+
+	// of the linear 2x2 part
+	float Determinant() const;
+
+	//
+	void Swap(Affine2D& rhs_);
+
+} Affine2D;
+
+// lhs_ applied after rhs_, same order as Matrix3x3
+Affine2D operator*(const Affine2D& lhs_, const Affine2D& rhs_);
+
+// point transform, translation applied
+Vector2D operator*(const Affine2D& aff_, const Vector2D& rhs_);
+
+// direction transform, translation ignored
+Vector2D Affine2DTransformVector(const Affine2D& aff_, const Vector2D& vec_);
+
+//
+Matrix3x3 Mtx33FromAffine2D(const Affine2D& aff_);
+
+//
+Affine2D Affine2DIdentity();
+
+//
+Affine2D Affine2DTranslate(float x_, float y_);
+
+//
+Affine2D Affine2DScale(float x_, float y_);
+
+//
+Affine2D Affine2DRotRad(float radians_);
+
+//
+Affine2D Affine2DRotDeg(float degrees_);
+
+//
+Affine2D Affine2DInverse(const Affine2D& aff_);
+
+#endif // AFFINE2D_H_
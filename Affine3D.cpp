@@ -0,0 +1,146 @@
+//
+#include "Affine3D.hpp"
+#include <algorithm> // std::swap()
+#include <corecrt_math_defines.h> // M_PI
+
+constexpr float EPSILON = 0.0001f;
+
+//
+Affine3D::Affine3D(const float* pArr_)
+{
+	for (size_t i{ 0 }; i < 12; ++i)
+	{ m[i] = *(pArr_ + i); }
+}
+
+//
+Affine3D::Affine3D(const float a00_, const float a01_, const float a02_, const float a03_,
+	const float a10_, const float a11_, const float a12_, const float a13_,
+	const float a20_, const float a21_, const float a22_, const float a23_)
+{
+	a00 = a00_; a01 = a01_; a02 = a02_; a03 = a03_;
+	a10 = a10_; a11 = a11_; a12 = a12_; a13 = a13_;
+	a20 = a20_; a21 = a21_; a22 = a22_; a23 = a23_;
+}
+
+//
+Affine3D::Affine3D(const Matrix4x4& mtx_)
+{
+	if (mtx_.a30 < -EPSILON || EPSILON < mtx_.a30 ||
+		mtx_.a31 < -EPSILON || EPSILON < mtx_.a31 ||
+		mtx_.a32 < -EPSILON || EPSILON < mtx_.a32 ||
+		mtx_.a33 < 1 - EPSILON || 1 + EPSILON < mtx_.a33)
+	{ throw "Matrix4x4 is not affine in Affine3D()"; }
+
+	for (size_t i{ 0 }; i < 12; ++i)
+	{ m[i] = mtx_.m[i]; }
+}
+
+//
+Affine3D& Affine3D::operator*=(const Affine3D& rhs_)
+{ return *this = *this * rhs_; }
+
+//
+float Affine3D::Determinant() const
+{
+	return a00 * (a11 * a22 - a12 * a21) -
+		a01 * (a10 * a22 - a12 * a20) +
+		a02 * (a10 * a21 - a11 * a20);
+}
+
+//
+void Affine3D::Swap(Affine3D& rhs_)
+{ std::swap((*this).m, rhs_.m); }
+
+//
+Affine3D operator*(const Affine3D& lhs_, const Affine3D& rhs_)
+{
+	// [L0 t0] * [L1 t1] = [L0 * L1, L0 * t1 + t0], the {0, 0, 0, 1} row never enters
+	Affine3D result;
+	for (size_t i{ 0 }; i < 3; ++i)
+	{
+		const float l0 = lhs_.m2[i][0], l1 = lhs_.m2[i][1], l2 = lhs_.m2[i][2];
+		result.m2[i][0] = l0 * rhs_.a00 + l1 * rhs_.a10 + l2 * rhs_.a20;
+		result.m2[i][1] = l0 * rhs_.a01 + l1 * rhs_.a11 + l2 * rhs_.a21;
+		result.m2[i][2] = l0 * rhs_.a02 + l1 * rhs_.a12 + l2 * rhs_.a22;
+		result.m2[i][3] = l0 * rhs_.a03 + l1 * rhs_.a13 + l2 * rhs_.a23 + lhs_.m2[i][3];
+	}
+	return result;
+}
+
+//
+Vector3D operator*(const Affine3D& aff_, const Vector3D& rhs_)
+{
+	return
+	{
+		aff_.a00 * rhs_.x + aff_.a01 * rhs_.y + aff_.a02 * rhs_.z + aff_.a03,
+		aff_.a10 * rhs_.x + aff_.a11 * rhs_.y + aff_.a12 * rhs_.z + aff_.a13,
+		aff_.a20 * rhs_.x + aff_.a21 * rhs_.y + aff_.a22 * rhs_.z + aff_.a23
+	};
+}
+
+//
+Vector3D Affine3DTransformVector(const Affine3D& aff_, const Vector3D& vec_)
+{
+	return
+	{
+		aff_.a00 * vec_.x + aff_.a01 * vec_.y + aff_.a02 * vec_.z,
+		aff_.a10 * vec_.x + aff_.a11 * vec_.y + aff_.a12 * vec_.z,
+		aff_.a20 * vec_.x + aff_.a21 * vec_.y + aff_.a22 * vec_.z
+	};
+}
+
+//
+Matrix4x4 Mtx44FromAffine3D(const Affine3D& aff_)
+{
+	return
+	{
+		aff_.a00, aff_.a01, aff_.a02, aff_.a03,
+		aff_.a10, aff_.a11, aff_.a12, aff_.a13,
+		aff_.a20, aff_.a21, aff_.a22, aff_.a23,
+		0, 0, 0, 1
+	};
+}
+
+//
+Affine3D Affine3DIdentity()
+{ return { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0 }; }
+
+//
+Affine3D Affine3DTranslate(const float x_, const float y_, const float z_)
+{ return { 1, 0, 0, x_, 0, 1, 0, y_, 0, 0, 1, z_ }; }
+
+//
+Affine3D Affine3DScale(const float x_, const float y_, const float z_)
+{ return { x_, 0, 0, 0, 0, y_, 0, 0, 0, 0, z_, 0 }; }
+
+//
+Affine3D Affine3DRotRad(const Vector3D axis_, const float radians_)
+{ return Affine3D(Mtx44RotRad(axis_, radians_)); }
+
+//
+Affine3D Affine3DRotDeg(const Vector3D axis_, const float degrees_)
+{ return Affine3DRotRad(axis_, static_cast<float>(degrees_ / 180.0f * M_PI)); }
+
+//
+Affine3D Affine3DInverse(const Affine3D& aff_)
+{
+	const float determinant = aff_.Determinant();
+	if (-EPSILON <= determinant && determinant <= EPSILON)
+	{ throw "Determinant = 0 in Affine3DInverse()"; }
+
+	// L^-1 = adjugate / det, then [L t]^-1 = [L^-1, -L^-1 * t]
+	const float inv_det = 1.0f / determinant;
+	Affine3D result;
+	result.a00 = (aff_.a11 * aff_.a22 - aff_.a12 * aff_.a21) * inv_det;
+	result.a01 = (aff_.a02 * aff_.a21 - aff_.a01 * aff_.a22) * inv_det;
+	result.a02 = (aff_.a01 * aff_.a12 - aff_.a02 * aff_.a11) * inv_det;
+	result.a10 = (aff_.a12 * aff_.a20 - aff_.a10 * aff_.a22) * inv_det;
+	result.a11 = (aff_.a00 * aff_.a22 - aff_.a02 * aff_.a20) * inv_det;
+	result.a12 = (aff_.a02 * aff_.a10 - aff_.a00 * aff_.a12) * inv_det;
+	result.a20 = (aff_.a10 * aff_.a21 - aff_.a11 * aff_.a20) * inv_det;
+	result.a21 = (aff_.a01 * aff_.a20 - aff_.a00 * aff_.a21) * inv_det;
+	result.a22 = (aff_.a00 * aff_.a11 - aff_.a01 * aff_.a10) * inv_det;
+	for (size_t i{ 0 }; i < 3; ++i)
+	{ result.m2[i][3] = -(result.m2[i][0] * aff_.a03 + result.m2[i][1] * aff_.a13 + result.m2[i][2] * aff_.a23); }
+	return result;
+}
@@ -0,0 +1,87 @@
+//
+#pragma once
+#ifndef AFFINE3D_H_
+#define AFFINE3D_H_
+
+#include "Matrix4x4.hpp"
+
+// 3x4 affine transform, the implicit last row is always {0, 0, 0, 1}
+typedef union Affine3D
+{
+	// some warning about a nameless struct
+	// but it's way more convenient this way :(
+	struct
+	{
+		float a00, a01, a02, a03;
+		float a10, a11, a12, a13;
+		float a20, a21, a22, a23;
+	};
+
+	float m[12]{};
+	float m2[3][4];
+
+	/* Constructors */
+
+	//
+	Affine3D() = default;
+
+	//
+	explicit Affine3D(const float* pArr_);
+
+	//
+	Affine3D(float a00_, float a01_, float a02_, float a03_,
+		float a10_, float a11_, float a12_, float a13_,
+		float a20_, float a21_, float a22_, float a23_);
+
+	// throws if the last row of mtx_ is not {0, 0, 0, 1}
+	explicit Affine3D(const Matrix4x4& mtx_);
+
+	/* Assignment operators */
+
+	//
+	Affine3D& operator=(const Affine3D& rhs_) = default;
+
+	//
+	Affine3D& operator*=(const Affine3D& rhs_);
+
+	/* Others */
+
+	// of the linear 3x3 part
+	float Determinant() const;
+
+	//
+	void Swap(Affine3D& rhs_);
+
+} Affine3D;
+
+// lhs_ applied after rhs_, same order as Matrix4x4
+Affine3D operator*(const Affine3D& lhs_, const Affine3D& rhs_);
+
+// point transform, translation applied
+Vector3D operator*(const Affine3D& aff_, const Vector3D& rhs_);
+
+// direction transform, translation ignored
+Vector3D Affine3DTransformVector(const Affine3D& aff_, const Vector3D& vec_);
+
+//
+Matrix4x4 Mtx44FromAffine3D(const Affine3D& aff_);
+
+//
+Affine3D Affine3DIdentity();
+
+//
+Affine3D Affine3DTranslate(float x_, float y_, float z_);
+
+//
+Affine3D Affine3DScale(float x_, float y_, float z_);
+
+//
+Affine3D Affine3DRotRad(Vector3D axis_, float radians_);
+
+//
+Affine3D Affine3DRotDeg(Vector3D axis_, float degrees_);
+
+//
+Affine3D Affine3DInverse(const Affine3D& aff_);
+
+#endif // AFFINE3D_H_
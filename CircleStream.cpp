@@ -0,0 +1,92 @@
+//
+#include "CircleStream.hpp"
+#include <cstring> // memcpy(), memset()
+#include <utility> // std::swap()
+
+//
+CircleStream::CircleStream(const Circle* pArr_, const size_t size_)
+{
+	Reserve(size_);
+	for (size_t i{ 0 }; i < size_; ++i)
+	{ Set(i, pArr_[i]); }
+	size = size_;
+}
+
+//
+CircleStream::CircleStream(const CircleStream& rhs_)
+{
+	Reserve(rhs_.size);
+	if (rhs_.size)
+	{
+		memcpy(center_x, rhs_.center_x, rhs_.size * sizeof(float));
+		memcpy(center_y, rhs_.center_y, rhs_.size * sizeof(float));
+		memcpy(radius, rhs_.radius, rhs_.size * sizeof(float));
+	}
+	size = rhs_.size;
+}
+
+//
+CircleStream::CircleStream(CircleStream&& rhs_) noexcept
+{ Swap(rhs_); }
+
+//
+CircleStream::~CircleStream()
+{ SIMDAlignedFree(center_x); }
+
+//
+CircleStream& CircleStream::operator=(CircleStream rhs_)
+{
+	// copy swap idiom
+	Swap(rhs_);
+	return *this;
+}
+
+//
+void CircleStream::Reserve(const size_t capacity_)
+{
+	if (capacity_ <= capacity)
+	{ return; }
+
+	// the three arrays share one block, each starts right after the last one's padding
+	const size_t padded = SIMDPaddedSize(capacity_);
+	float* block = static_cast<float*>(SIMDAlignedAlloc(3 * padded * sizeof(float)));
+	memset(block, 0, 3 * padded * sizeof(float));
+	if (size)
+	{
+		memcpy(block, center_x, size * sizeof(float));
+		memcpy(block + padded, center_y, size * sizeof(float));
+		memcpy(block + 2 * padded, radius, size * sizeof(float));
+	}
+	SIMDAlignedFree(center_x);
+	center_x = block;
+	center_y = block + padded;
+	radius = block + 2 * padded;
+	capacity = padded;
+}
+
+//
+void CircleStream::PushBack(const Circle& circle_)
+{
+	if (size == capacity)
+	{ Reserve(capacity ? capacity * 2 : SIMD_WIDTH); }
+	Set(size++, circle_);
+}
+
+//
+void CircleStream::Clear()
+{
+	// zero what was in use so the padding stays zero
+	for (size_t f{ 0 }; f < 3 && size; ++f)
+	{ memset(center_x + f * capacity, 0, size * sizeof(float)); }
+	size = 0;
+}
+
+//
+void CircleStream::Swap(CircleStream& rhs_) noexcept
+{
+	std::swap(center_x, rhs_.center_x);
+	std::swap(center_y, rhs_.center_y);
+	std::swap(radius, rhs_.radius);
+	std::swap(size, rhs_.size);
+	std::swap(capacity, rhs_.capacity);
+}
@@ -0,0 +1,75 @@
+//
+#pragma once
+#ifndef CIRCLE_STREAM_HPP_
+#define CIRCLE_STREAM_HPP_
+
+#include "SIMD.hpp"
+#include "Types.hpp"
+
+// structure-of-arrays Circle storage for the narrowphase after broadphase. Only
+// the shape is kept, Get() hands back the default mass. Like Vec2Stream all three
+// arrays share one SIMD_ALIGNMENT aligned block, zero padded to a multiple of SIMD_WIDTH.
+struct CircleStream
+{
+	float* center_x{ nullptr };
+	float* center_y{ nullptr };
+	float* radius{ nullptr };
+
+	/* Constructors */
+
+	//
+	CircleStream() = default;
+
+	//
+	CircleStream(const Circle* pArr_, size_t size_);
+
+	//
+	CircleStream(const CircleStream& rhs_);
+
+	//
+	CircleStream(CircleStream&& rhs_) noexcept;
+
+	//
+	~CircleStream();
+
+	/* Assignment Operators */
+
+	//
+	CircleStream& operator=(CircleStream rhs_);
+
+	/* Others */
+
+	//
+	size_t Size() const
+	{ return size; }
+
+	//
+	size_t Capacity() const
+	{ return capacity; }
+
+	//
+	Circle Get(size_t i_) const
+	{ return { { center_x[i_], center_y[i_] }, radius[i_] }; }
+
+	//
+	void Set(size_t i_, const Circle& circle_)
+	{ center_x[i_] = circle_.center.x; center_y[i_] = circle_.center.y; radius[i_] = circle_.radius; }
+
+	//
+	void Reserve(size_t capacity_);
+
+	//
+	void PushBack(const Circle& circle_);
+
+	//
+	void Clear();
+
+	//
+	void Swap(CircleStream& rhs_) noexcept;
+
+private:
+	size_t size{ 0 };
+	size_t capacity{ 0 };
+};
+
+#endif // CIRCLE_STREAM_HPP_
@@ -1,7 +1,1601 @@
 //
 #include "CollisionDetection.hpp"
 
+#include <cfloat> // FLT_MAX
 #include <corecrt_math.h> // sqrt()
+#include <utility> // std::swap()
+
+namespace
+{
+	//
+	float Clamp01(const float t_)
+	{ return t_ < 0 ? 0 : (t_ > 1 ? 1 : t_); }
+
+	//
+	Pt2 ClosestPointOnSegment(const Pt2 pt0_, const Pt2 pt1_, const Pt2 point_)
+	{
+		const Vec2 seg = pt1_ - pt0_;
+		const float len_sq = seg.LengthSq();
+		const float t = len_sq > 0 ? Vector2DDotProduct(point_ - pt0_, seg) / len_sq : 0;
+		return pt0_ + seg * Clamp01(t);
+	}
+
+	// squared distance between segments p0_ - p1_ and q0_ - q1_, Ericson 5.1.9.
+	// Crossing segments come out at distance 0 from the unclamped solution
+	float SegmentSegment(const Pt2 p0_, const Pt2 p1_, const Pt2 q0_, const Pt2 q1_, Pt2& closest_p_, Pt2& closest_q_)
+	{
+		const Vec2 d1 = p1_ - p0_, d2 = q1_ - q0_, r = p0_ - q0_;
+		const float a = d1.LengthSq(), e = d2.LengthSq(), f = Vector2DDotProduct(d2, r);
+		const float eps_sq = VEC2_EPSILON * VEC2_EPSILON;
+		float s{ 0 }, t{ 0 };
+		if (a <= eps_sq && e <= eps_sq)
+		{ /* both are points */ }
+		else if (a <= eps_sq)
+		{ t = Clamp01(f / e); }
+		else
+		{
+			const float c = Vector2DDotProduct(d1, r);
+			if (e <= eps_sq)
+			{ s = Clamp01(-c / a); }
+			else
+			{
+				// parallel segments have denom 0, any s works so start from p0_
+				const float b = Vector2DDotProduct(d1, d2);
+				const float denom = a * e - b * b;
+				s = denom > 0 ? Clamp01((b * f - c * e) / denom) : 0;
+				t = (b * s + f) / e;
+				if (t < 0)
+				{ t = 0; s = Clamp01(-c / a); }
+				else if (t > 1)
+				{ t = 1; s = Clamp01((b - c) / a); }
+			}
+		}
+		closest_p_ = p0_ + d1 * s;
+		closest_q_ = q0_ + d2 * t;
+		return (closest_p_ - closest_q_).LengthSq();
+	}
+
+	//
+	float PointAABBDistSq(const Pt2 point_, const AABB& aabb_)
+	{
+		const float dx = point_.x - fminf(fmaxf(point_.x, aabb_.min.x), aabb_.max.x);
+		const float dy = point_.y - fminf(fmaxf(point_.y, aabb_.min.y), aabb_.max.y);
+		return dx * dx + dy * dy;
+	}
+
+	// CDStatic_CircleRect() with the contact, by value so both batch directions share it.
+	// A center inside the box is pushed out through the nearest side, selects rather than
+	// branches so the SIMD kernels below do the same thing lane by lane
+	bool CircleAABBContact(const float cx_, const float cy_, const float radius_, const float min_x_, const float min_y_,
+		const float max_x_, const float max_y_, float& closest_x_, float& closest_y_, float& depth_)
+	{
+		const float qx = fminf(fmaxf(cx_, min_x_), max_x_), qy = fminf(fmaxf(cy_, min_y_), max_y_);
+		const float dist_sq = (cx_ - qx) * (cx_ - qx) + (cy_ - qy) * (cy_ - qy);
+		const float left = cx_ - min_x_, right = max_x_ - cx_, bottom = cy_ - min_y_, top = max_y_ - cy_;
+		const float side_x = fminf(left, right), side_y = fminf(bottom, top);
+		const bool inside = dist_sq == 0, along_x = side_x <= side_y;
+		closest_x_ = inside && along_x ? (left < right ? min_x_ : max_x_) : qx;
+		closest_y_ = inside && !along_x ? (bottom < top ? min_y_ : max_y_) : qy;
+		depth_ = radius_ + (inside ? fminf(side_x, side_y) : -sqrtf(dist_sq));
+		return dist_sq <= radius_ * radius_;
+	}
+
+	// stands in for a 0 velocity component in the slab tests, so the slab distances
+	// stay finite instead of turning into 0 * inf = NaN, as in CollisionDetection3D.cpp
+	constexpr float SLAB_TINY = 1e-30f;
+
+	//
+	float SafeInverse(const float vel_)
+	{ return 1.0f / (fabsf(vel_) < SLAB_TINY ? copysignf(SLAB_TINY, vel_) : vel_); }
+
+	// a point at (px_, py_) moving by (vx_, vy_) against a still circle, Ericson 5.3.2 with the
+	// velocity left unnormalized. Inside is a hit at 0, like CDStatic_CirclePoint() apart from touching
+	bool PointCircleSweep(const float px_, const float py_, const float vx_, const float vy_, const float cx_, const float cy_,
+		const float radius_, float& inter_time_)
+	{
+		const float mx = px_ - cx_, my = py_ - cy_;
+		const float a = vx_ * vx_ + vy_ * vy_, b = mx * vx_ + my * vy_;
+		const float c = mx * mx + my * my - radius_ * radius_;
+		if (c < 0)
+		{
+			inter_time_ = 0;
+			return true;
+		}
+		const float disc = b * b - a * c;
+		if (b >= 0 || disc < 0)
+		{ return false; }
+		inter_time_ = (-b - sqrtf(disc)) / a;
+		return inter_time_ <= 1;
+	}
+
+	// a point moving against a still aabb_, the slab entry time clamped to [0, 1].
+	// Boundary included like CDStatic_RectPoint(), so a point inside hits at 0
+	bool PointAABBSweep(const float px_, const float py_, const float vx_, const float vy_, const AABB& aabb_,
+		float& inter_time_)
+	{
+		const float inv_x = SafeInverse(vx_), inv_y = SafeInverse(vy_);
+		const float tx0 = (aabb_.min.x - px_) * inv_x, tx1 = (aabb_.max.x - px_) * inv_x;
+		const float ty0 = (aabb_.min.y - py_) * inv_y, ty1 = (aabb_.max.y - py_) * inv_y;
+		const float enter = fmaxf(fmaxf(fminf(tx0, tx1), fminf(ty0, ty1)), 0.0f);
+		const float exit = fminf(fminf(fmaxf(tx0, tx1), fmaxf(ty0, ty1)), 1.0f);
+		inter_time_ = enter;
+		return enter <= exit;
+	}
+
+	// the times a box over [moving_min_, moving_max_] shifted by vel_ * t overlaps [min_, max_] along one axis.
+	// inv_vel_ is SafeInverse(vel_), enter_ > exit_ if the axis separates for the whole frame
+	void AxisSweep(const float min_, const float max_, const float moving_min_, const float moving_max_, const float vel_,
+		const float inv_vel_, float& enter_, float& exit_)
+	{
+		if (fabsf(vel_) < SLAB_TINY)
+		{
+			// no motion along this axis, it separates for the whole frame or never. Decided
+			// here rather than through the slab times so boxes that only touch stay apart
+			enter_ = min_ < moving_max_ && moving_min_ < max_ ? -FLT_MAX : FLT_MAX;
+			exit_ = -enter_;
+			return;
+		}
+		const float t0 = (min_ - moving_max_) * inv_vel_, t1 = (max_ - moving_min_) * inv_vel_;
+		enter_ = fminf(t0, t1);
+		exit_ = fmaxf(t0, t1);
+	}
+
+	// moving_ shifted by vel_ over one frame against a still box, touching does not count like
+	// CDStatic_RectRect_AABB(). normal_ is the still box's face moving_ comes in through, 0 if they overlap at the start
+	bool AABBSweep(const float min_x_, const float min_y_, const float max_x_, const float max_y_, const AABB& moving_,
+		const Vec2 vel_, const Vec2 inv_vel_, float& inter_time_, float& exit_time_, Vec2& normal_)
+	{
+		float enter_x, exit_x, enter_y, exit_y;
+		AxisSweep(min_x_, max_x_, moving_.min.x, moving_.max.x, vel_.x, inv_vel_.x, enter_x, exit_x);
+		AxisSweep(min_y_, max_y_, moving_.min.y, moving_.max.y, vel_.y, inv_vel_.y, enter_y, exit_y);
+		const float enter = fmaxf(enter_x, enter_y), exit = fminf(exit_x, exit_y);
+		if (enter >= exit || enter >= 1 || exit <= 0)
+		{ return false; }
+		inter_time_ = fmaxf(enter, 0.0f);
+		exit_time_ = fminf(exit, 1.0f);
+		normal_ = Vec2(0, 0);
+		if (enter >= 0)
+		{
+			if (enter_x >= enter_y)
+			{ normal_.x = vel_.x > 0 ? -1.0f : 1.0f; }
+			else
+			{ normal_.y = vel_.y > 0 ? -1.0f : 1.0f; }
+		}
+		return true;
+	}
+
+	// slab test, t clipped to the segment's [0, 1]
+	bool SegmentCrossesAABB(const Pt2 pt0_, const Pt2 pt1_, const AABB& aabb_)
+	{
+		const Vec2 dir = pt1_ - pt0_;
+		float enter{ 0 }, exit{ 1 };
+		for (size_t i{ 0 }; i < 2; ++i)
+		{
+			if (-VEC2_EPSILON < dir.m[i] && dir.m[i] < VEC2_EPSILON)
+			{
+				if (pt0_.m[i] < aabb_.min.m[i] || aabb_.max.m[i] < pt0_.m[i])
+				{ return false; }
+				continue;
+			}
+			float t0 = (aabb_.min.m[i] - pt0_.m[i]) / dir.m[i], t1 = (aabb_.max.m[i] - pt0_.m[i]) / dir.m[i];
+			if (t0 > t1)
+			{ std::swap(t0, t1); }
+			enter = fmaxf(enter, t0);
+			exit = fminf(exit, t1);
+			if (enter > exit)
+			{ return false; }
+		}
+		return true;
+	}
+
+	// separation of polygon_1_ from edge_ of polygon_0_, > 0 if that edge's normal separates them
+	float EdgeSeparation(const ConvexPolygon2D& polygon_0_, const size_t edge_, const ConvexPolygon2D& polygon_1_)
+	{
+		const Vec2 normal = polygon_0_.normals[edge_];
+		return Vector2DDotProduct(normal, polygon_1_.Support(-normal) - polygon_0_.vertices[edge_]);
+	}
+
+	// one vertex of the Minkowski difference polygon_0_ - polygon_1_, a and b kept for the closest points
+	struct SimplexVertex
+	{
+		Pt2 a, b;
+		Vec2 w;
+		float u;
+	};
+
+	//
+	SimplexVertex MinkowskiSupport(const ConvexPolygon2D& polygon_0_, const ConvexPolygon2D& polygon_1_, const Vec2 dir_)
+	{
+		SimplexVertex vertex;
+		vertex.a = polygon_0_.Support(dir_);
+		vertex.b = polygon_1_.Support(-dir_);
+		vertex.w = vertex.a - vertex.b;
+		vertex.u = 1;
+		return vertex;
+	}
+
+	// reduces simplex_ to the smallest sub-simplex holding its point closest to the origin
+	// and sets the barycentric u of each vertex, Box2D's b2Simplex::Solve2() and Solve3()
+	void GJKSolve(SimplexVertex (&simplex_)[3], size_t& count_)
+	{
+		if (count_ == 2)
+		{
+			const Vec2 w1 = simplex_[0].w, w2 = simplex_[1].w, e12 = w2 - w1;
+			const float d12_1 = Vector2DDotProduct(w2, e12), d12_2 = -Vector2DDotProduct(w1, e12);
+			if (d12_2 <= 0)
+			{ simplex_[0].u = 1; count_ = 1; }
+			else if (d12_1 <= 0)
+			{ simplex_[1].u = 1; simplex_[0] = simplex_[1]; count_ = 1; }
+			else
+			{
+				const float inv = 1.0f / (d12_1 + d12_2);
+				simplex_[0].u = d12_1 * inv;
+				simplex_[1].u = d12_2 * inv;
+			}
+		}
+		else if (count_ == 3)
+		{
+			const Vec2 w1 = simplex_[0].w, w2 = simplex_[1].w, w3 = simplex_[2].w;
+			const Vec2 e12 = w2 - w1, e13 = w3 - w1, e23 = w3 - w2;
+			const float d12_1 = Vector2DDotProduct(w2, e12), d12_2 = -Vector2DDotProduct(w1, e12);
+			const float d13_1 = Vector2DDotProduct(w3, e13), d13_2 = -Vector2DDotProduct(w1, e13);
+			const float d23_1 = Vector2DDotProduct(w3, e23), d23_2 = -Vector2DDotProduct(w2, e23);
+			const float n123 = Vector2DCrossProductMag(e12, e13);
+			const float d123_1 = n123 * Vector2DCrossProductMag(w2, w3);
+			const float d123_2 = n123 * Vector2DCrossProductMag(w3, w1);
+			const float d123_3 = n123 * Vector2DCrossProductMag(w1, w2);
+
+			if (d12_2 <= 0 && d13_2 <= 0)
+			{ simplex_[0].u = 1; count_ = 1; }
+			else if (d12_1 > 0 && d12_2 > 0 && d123_3 <= 0)
+			{
+				const float inv = 1.0f / (d12_1 + d12_2);
+				simplex_[0].u = d12_1 * inv;
+				simplex_[1].u = d12_2 * inv;
+				count_ = 2;
+			}
+			else if (d13_1 > 0 && d13_2 > 0 && d123_2 <= 0)
+			{
+				const float inv = 1.0f / (d13_1 + d13_2);
+				simplex_[0].u = d13_1 * inv;
+				simplex_[2].u = d13_2 * inv;
+				simplex_[1] = simplex_[2];
+				count_ = 2;
+			}
+			else if (d12_1 <= 0 && d23_2 <= 0)
+			{ simplex_[1].u = 1; simplex_[0] = simplex_[1]; count_ = 1; }
+			else if (d13_1 <= 0 && d23_1 <= 0)
+			{ simplex_[2].u = 1; simplex_[0] = simplex_[2]; count_ = 1; }
+			else if (d23_1 > 0 && d23_2 > 0 && d123_1 <= 0)
+			{
+				const float inv = 1.0f / (d23_1 + d23_2);
+				simplex_[1].u = d23_1 * inv;
+				simplex_[2].u = d23_2 * inv;
+				simplex_[0] = simplex_[2];
+				count_ = 2;
+			}
+			else
+			{
+				// origin inside the triangle
+				const float inv = 1.0f / (d123_1 + d123_2 + d123_3);
+				simplex_[0].u = d123_1 * inv;
+				simplex_[1].u = d123_2 * inv;
+				simplex_[2].u = d123_3 * inv;
+			}
+		}
+	}
+
+	// GJK distance, leaves the final simplex behind for EPA. Returns 0 on overlap or touching
+	float GJK(const ConvexPolygon2D& polygon_0_, const ConvexPolygon2D& polygon_1_,
+		SimplexVertex (&simplex_)[3], size_t& count_, Pt2& closest_0_, Pt2& closest_1_)
+	{
+		// the Minkowski difference has at most 2 * MAX_VERTICES vertices, GJK visits each at most once or so
+		constexpr size_t MAX_ITERATIONS = 4 * ConvexPolygon2D::MAX_VERTICES;
+		const float eps_sq = VEC2_EPSILON * VEC2_EPSILON;
+
+		simplex_[0] = MinkowskiSupport(polygon_0_, polygon_1_, polygon_1_.vertices[0] - polygon_0_.vertices[0]);
+		count_ = 1;
+		bool overlap{ false };
+		for (size_t iteration{ 0 }; iteration < MAX_ITERATIONS; ++iteration)
+		{
+			GJKSolve(simplex_, count_);
+			if (count_ == 3)
+			{ overlap = true; break; }
+
+			Vec2 closest{ 0, 0 };
+			for (size_t i{ 0 }; i < count_; ++i)
+			{ closest += simplex_[i].w * simplex_[i].u; }
+			if (closest.LengthSq() <= eps_sq)
+			{ overlap = true; break; }
+
+			// stop once the new support point is no closer to the origin than the simplex
+			const Vec2 dir = -closest;
+			const SimplexVertex vertex = MinkowskiSupport(polygon_0_, polygon_1_, dir);
+			if (Vector2DDotProduct(vertex.w - closest, dir) <= VEC2_EPSILON * dir.Length())
+			{ break; }
+			bool duplicate{ false };
+			for (size_t i{ 0 }; i < count_; ++i)
+			{ duplicate = duplicate || (simplex_[i].a == vertex.a && simplex_[i].b == vertex.b); }
+			if (duplicate)
+			{ break; }
+			simplex_[count_++] = vertex;
+		}
+
+		closest_0_ = { 0, 0 };
+		closest_1_ = { 0, 0 };
+		for (size_t i{ 0 }; i < count_; ++i)
+		{
+			closest_0_ += simplex_[i].a * simplex_[i].u;
+			closest_1_ += simplex_[i].b * simplex_[i].u;
+		}
+		return overlap ? 0 : (closest_0_ - closest_1_).Length();
+	}
+
+	// expands the simplex GJK ended with into the Minkowski difference's face closest to the
+	// origin. Returns false if the polygons only touch
+	bool EPA(const ConvexPolygon2D& polygon_0_, const ConvexPolygon2D& polygon_1_,
+		const SimplexVertex (&simplex_)[3], const size_t count_, Vec2& mtv_)
+	{
+		// a face is added per iteration and the difference has at most 2 * MAX_VERTICES of them
+		constexpr size_t MAX_POINTS = 2 * ConvexPolygon2D::MAX_VERTICES + 4;
+		Vec2 points[MAX_POINTS];
+		size_t count{ count_ };
+		for (size_t i{ 0 }; i < count_; ++i)
+		{ points[i] = simplex_[i].w; }
+
+		// GJK can stop on a point or an edge through the origin, grow it into a triangle
+		const auto support = [&](const Vec2 dir_) { return MinkowskiSupport(polygon_0_, polygon_1_, dir_).w; };
+		if (count == 1)
+		{
+			points[1] = support({ 1, 0 });
+			if ((points[1] - points[0]).LengthSq() <= VEC2_EPSILON * VEC2_EPSILON)
+			{ points[1] = support({ -1, 0 }); }
+			count = 2;
+		}
+		if (count == 2)
+		{
+			const Vec2 edge = points[1] - points[0];
+			const Vec2 normal{ -edge.y, edge.x };
+			points[2] = support(normal);
+			if (Vector2DDotProduct(points[2] - points[0], normal) <= VEC2_EPSILON * normal.Length())
+			{ points[2] = support(-normal); }
+			count = 3;
+		}
+		float area = Vector2DCrossProductMag(points[1] - points[0], points[2] - points[0]);
+		if (-VEC2_EPSILON * VEC2_EPSILON <= area && area <= VEC2_EPSILON * VEC2_EPSILON)
+		{ return false; }
+		if (area < 0)
+		{ std::swap(points[1], points[2]); }
+
+		Vec2 normal{ 0, 0 };
+		float depth{ 0 };
+		for (;;)
+		{
+			// counter-clockwise, so {edge.y, -edge.x} points outwards
+			size_t closest{ 0 };
+			depth = -1;
+			for (size_t i{ 0 }; i < count; ++i)
+			{
+				const Vec2 edge = points[(i + 1) % count] - points[i];
+				const float length = edge.Length();
+				if (length <= VEC2_EPSILON)
+				{ continue; }
+				const Vec2 face_normal = Vec2{ edge.y, -edge.x } * (1.0f / length);
+				const float dist = Vector2DDotProduct(face_normal, points[i]);
+				if (depth < 0 || dist < depth)
+				{ closest = i; depth = dist; normal = face_normal; }
+			}
+
+			const Vec2 w = support(normal);
+			if (Vector2DDotProduct(w, normal) - depth <= VEC2_EPSILON || count == MAX_POINTS)
+			{ break; }
+			for (size_t i{ count }; i > closest + 1; --i)
+			{ points[i] = points[i - 1]; }
+			points[closest + 1] = w;
+			++count;
+		}
+		if (depth <= 0)
+		{ return false; }
+
+		// moving polygon_0_ by mtv_ moves the difference's closest face onto the origin
+		mtv_ = normal * -depth;
+		return true;
+	}
+
+	// the candidate axes are both boxes' local axes, radii_[i] is the sum of the two
+	// boxes' projections onto axes_[i], |u_i . v_j| written with the relative rotation
+	void OBBAxes(const OBB2D& a_, const OBB2D& b_, Vec2 (&axes_)[4], float (&radii_)[4])
+	{
+		const float cr = fabsf(a_.rot.c * b_.rot.c + a_.rot.s * b_.rot.s);
+		const float sr = fabsf(a_.rot.s * b_.rot.c - a_.rot.c * b_.rot.s);
+		axes_[0] = { a_.rot.c, a_.rot.s };
+		axes_[1] = { -a_.rot.s, a_.rot.c };
+		axes_[2] = { b_.rot.c, b_.rot.s };
+		axes_[3] = { -b_.rot.s, b_.rot.c };
+		radii_[0] = a_.half_ext.x + b_.half_ext.x * cr + b_.half_ext.y * sr;
+		radii_[1] = a_.half_ext.y + b_.half_ext.x * sr + b_.half_ext.y * cr;
+		radii_[2] = a_.half_ext.x * cr + a_.half_ext.y * sr + b_.half_ext.x;
+		radii_[3] = a_.half_ext.x * sr + a_.half_ext.y * cr + b_.half_ext.y;
+	}
+
+	// returns at the first separating axis, tracks the least overlap only if mtv_ is wanted
+	bool OBBOBB(const OBB2D& a_, const OBB2D& b_, Vec2* mtv_)
+	{
+		Vec2 axes[4];
+		float radii[4];
+		OBBAxes(a_, b_, axes, radii);
+
+		const Vec2 dist = b_.center - a_.center;
+		float min_overlap{ 0 }, min_proj{ 0 };
+		size_t min_axis{ 0 };
+		for (size_t i{ 0 }; i < 4; ++i)
+		{
+			const float proj = Vector2DDotProduct(dist, axes[i]);
+			const float overlap = radii[i] - fabsf(proj);
+			if (overlap <= 0)
+			{ return false; }
+			if (i == 0 || overlap < min_overlap)
+			{ min_overlap = overlap; min_proj = proj; min_axis = i; }
+		}
+		// away from b_'s center
+		if (mtv_)
+		{ *mtv_ = axes[min_axis] * (min_proj < 0 ? min_overlap : -min_overlap); }
+		return true;
+	}
+
+	// mtv_ as in CDStatic_CircleOBB(), may be nullptr
+	bool CircleOBB(const Circle& circle_, const OBB2D& obb_, Vec2* mtv_)
+	{
+		// closest point of the box in its own frame
+		const Vec2 local = Rot2InverseRotate(obb_.rot, circle_.center - obb_.center);
+		const Vec2 closest{ fminf(fmaxf(local.x, -obb_.half_ext.x), obb_.half_ext.x),
+			fminf(fmaxf(local.y, -obb_.half_ext.y), obb_.half_ext.y) };
+		const Vec2 diff = local - closest;
+		const float dist_sq = Vector2DDotProduct(diff, diff);
+		if (dist_sq > circle_.radius * circle_.radius)
+		{ return false; }
+
+		if (mtv_)
+		{
+			if (dist_sq > 0)
+			{
+				const float dist = sqrtf(dist_sq);
+				*mtv_ = obb_.rot * (diff * ((circle_.radius - dist) / dist));
+			}
+			else
+			{
+				// center inside, out through the nearest face
+				const float face_x = obb_.half_ext.x - fabsf(local.x), face_y = obb_.half_ext.y - fabsf(local.y);
+				const Vec2 out = face_x < face_y ?
+					Vec2{ local.x < 0 ? -(face_x + circle_.radius) : face_x + circle_.radius, 0 } :
+					Vec2{ 0, local.y < 0 ? -(face_y + circle_.radius) : face_y + circle_.radius };
+				*mtv_ = obb_.rot * out;
+			}
+		}
+		return true;
+	}
+
+	/* SCALAR KERNELS */
+	// also used for the tails of the SIMD kernels, hence begin_
+
+	// along the segment the circle is compared against the closest point, so
+	// the overshoot past either end is min(along, 0) + max(along - length, 0)
+	size_t CircleLineSegmentScalar(size_t* hits_, size_t count_, const Circle& circle_, const LineSegmentStream& seg_,
+		size_t begin_, const size_t n_)
+	{
+		const float radius_sq = circle_.radius * circle_.radius;
+		for (; begin_ < n_; ++begin_)
+		{
+			const float dx = circle_.center.x - seg_.p0_x[begin_], dy = circle_.center.y - seg_.p0_y[begin_];
+			const float side = seg_.dir_y[begin_] * circle_.center.x - seg_.dir_x[begin_] * circle_.center.y - seg_.offset[begin_];
+			const float along = seg_.dir_x[begin_] * dx + seg_.dir_y[begin_] * dy;
+			const float over = fminf(along, 0.0f) + fmaxf(along - seg_.length[begin_], 0.0f);
+			hits_[count_] = begin_;
+			count_ += side * side + over * over <= radius_sq;
+		}
+		return count_;
+	}
+
+	// bit i % 8 of hits_[i / 8], begin_ is always a multiple of 8
+	void AABBAABBScalar(uint8_t* hits_, const AABB& aabb_, const AABBStream& boxes_, size_t begin_, const size_t n_)
+	{
+		for (; begin_ < n_; ++begin_)
+		{
+			const bool hit = aabb_.min.x < boxes_.max_x[begin_] && boxes_.min_x[begin_] < aabb_.max.x &&
+				aabb_.min.y < boxes_.max_y[begin_] && boxes_.min_y[begin_] < aabb_.max.y;
+			if (begin_ % 8 == 0)
+			{ hits_[begin_ / 8] = 0; }
+			hits_[begin_ / 8] |= static_cast<uint8_t>(hit << (begin_ % 8));
+		}
+	}
+
+	// distance to the clamped center, no branches
+	void CircleAABBScalar(uint8_t* hits_, const Circle& circle_, const AABBStream& boxes_, size_t begin_, const size_t n_)
+	{
+		const float radius_sq = circle_.radius * circle_.radius;
+		for (; begin_ < n_; ++begin_)
+		{
+			const float dx = circle_.center.x - fminf(fmaxf(circle_.center.x, boxes_.min_x[begin_]), boxes_.max_x[begin_]);
+			const float dy = circle_.center.y - fminf(fmaxf(circle_.center.y, boxes_.min_y[begin_]), boxes_.max_y[begin_]);
+			const bool hit = dx * dx + dy * dy <= radius_sq;
+			if (begin_ % 8 == 0)
+			{ hits_[begin_ / 8] = 0; }
+			hits_[begin_ / 8] |= static_cast<uint8_t>(hit << (begin_ % 8));
+		}
+	}
+
+	// touching does not count, like CDStatic_CircleCircle()
+	bool CircleCircle(const Circle& circle_, const CircleStream& circles_, const size_t i_)
+	{
+		const float dx = circles_.center_x[i_] - circle_.center.x, dy = circles_.center_y[i_] - circle_.center.y;
+		const float sum = circle_.radius + circles_.radius[i_];
+		return sum * sum > dx * dx + dy * dy;
+	}
+
+	//
+	void CircleCircleScalar(uint8_t* hits_, const Circle& circle_, const CircleStream& circles_, size_t begin_, const size_t n_)
+	{
+		for (; begin_ < n_; ++begin_)
+		{
+			const bool hit = CircleCircle(circle_, circles_, begin_);
+			if (begin_ % 8 == 0)
+			{ hits_[begin_ / 8] = 0; }
+			hits_[begin_ / 8] |= static_cast<uint8_t>(hit << (begin_ % 8));
+		}
+	}
+
+	// the index list form, written unconditionally and kept on a hit like CircleLineSegmentScalar()
+	size_t CircleCircleScalar(size_t* hits_, size_t count_, const Circle& circle_, const CircleStream& circles_, size_t begin_,
+		const size_t n_)
+	{
+		for (; begin_ < n_; ++begin_)
+		{
+			hits_[count_] = begin_;
+			count_ += CircleCircle(circle_, circles_, begin_);
+		}
+		return count_;
+	}
+
+	// pairs i < j from row begin_ on, two entries of pairs_ per pair
+	size_t CircleCirclePairsScalar(size_t* pairs_, size_t count_, const CircleStream& circles_, size_t begin_, const size_t n_)
+	{
+		for (; begin_ < n_; ++begin_)
+		{
+			const Circle circle = circles_.Get(begin_);
+			for (size_t j{ begin_ + 1 }; j < n_; ++j)
+			{
+				pairs_[2 * count_] = begin_;
+				pairs_[2 * count_ + 1] = j;
+				count_ += CircleCircle(circle, circles_, j);
+			}
+		}
+		return count_;
+	}
+
+	// lanes of the block of width_ columns at j_ that pair with row i_: past i_ and before n_
+	int PairLanes(const size_t i_, const size_t j_, const size_t n_, const size_t width_)
+	{
+		int lanes = (1 << width_) - 1;
+		if (i_ >= j_)
+		{ lanes = i_ - j_ + 1 < width_ ? lanes << (i_ - j_ + 1) & lanes : 0; }
+		if (n_ - j_ < width_)
+		{ lanes &= (1 << (n_ - j_)) - 1; }
+		return lanes;
+	}
+
+	// appends a hit mask of the block at j_ to pairs_, one loop trip per lane up to the last hit
+	size_t EmitPairs(size_t* pairs_, size_t count_, const size_t i_, const size_t j_, int mask_)
+	{
+		for (size_t k{ 0 }; mask_; ++k, mask_ >>= 1)
+		{
+			pairs_[2 * count_] = i_;
+			pairs_[2 * count_ + 1] = j_ + k;
+			count_ += mask_ & 1;
+		}
+		return count_;
+	}
+
+	//
+	void CircleAABBContactScalar(uint8_t* hits_, float* closest_x_, float* closest_y_, float* depth_, const Circle& circle_,
+		const AABBStream& boxes_, size_t begin_, const size_t n_)
+	{
+		for (; begin_ < n_; ++begin_)
+		{
+			const bool hit = CircleAABBContact(circle_.center.x, circle_.center.y, circle_.radius,
+				boxes_.min_x[begin_], boxes_.min_y[begin_], boxes_.max_x[begin_], boxes_.max_y[begin_],
+				closest_x_[begin_], closest_y_[begin_], depth_[begin_]);
+			if (begin_ % 8 == 0)
+			{ hits_[begin_ / 8] = 0; }
+			hits_[begin_ / 8] |= static_cast<uint8_t>(hit << (begin_ % 8));
+		}
+	}
+
+	// many circles against one box
+	void CirclesAABBScalar(uint8_t* hits_, const CircleStream& circles_, const AABB& aabb_, size_t begin_, const size_t n_)
+	{
+		for (; begin_ < n_; ++begin_)
+		{
+			const float dx = circles_.center_x[begin_] - fminf(fmaxf(circles_.center_x[begin_], aabb_.min.x), aabb_.max.x);
+			const float dy = circles_.center_y[begin_] - fminf(fmaxf(circles_.center_y[begin_], aabb_.min.y), aabb_.max.y);
+			const bool hit = dx * dx + dy * dy <= circles_.radius[begin_] * circles_.radius[begin_];
+			if (begin_ % 8 == 0)
+			{ hits_[begin_ / 8] = 0; }
+			hits_[begin_ / 8] |= static_cast<uint8_t>(hit << (begin_ % 8));
+		}
+	}
+
+	//
+	void CirclesAABBContactScalar(uint8_t* hits_, float* closest_x_, float* closest_y_, float* depth_,
+		const CircleStream& circles_, const AABB& aabb_, size_t begin_, const size_t n_)
+	{
+		for (; begin_ < n_; ++begin_)
+		{
+			const bool hit = CircleAABBContact(circles_.center_x[begin_], circles_.center_y[begin_], circles_.radius[begin_],
+				aabb_.min.x, aabb_.min.y, aabb_.max.x, aabb_.max.y, closest_x_[begin_], closest_y_[begin_], depth_[begin_]);
+			if (begin_ % 8 == 0)
+			{ hits_[begin_ / 8] = 0; }
+			hits_[begin_ / 8] |= static_cast<uint8_t>(hit << (begin_ % 8));
+		}
+	}
+
+	// CDStatic_CircleRay() with the ray's unit direction and 1 / length worked out once by the
+	// caller. Rejects on m < 0 from outside and on n^2 > r^2 before the square root
+	bool CircleRay(const Pt2 pt_, const Vec2 unit_, const float inv_length_, const CircleStream& circles_, const size_t i_,
+		float& inter_time_)
+	{
+		const float bx = circles_.center_x[i_] - pt_.x, by = circles_.center_y[i_] - pt_.y;
+		const float radius_sq = circles_.radius[i_] * circles_.radius[i_];
+		const float m = unit_.x * bx + unit_.y * by, dist_sq = bx * bx + by * by;
+		const float n_sq = dist_sq - m * m;
+		if ((m < 0 && dist_sq > radius_sq) || n_sq > radius_sq)
+		{ return false; }
+		inter_time_ = (m - sqrtf(radius_sq - n_sq)) * inv_length_;
+		return 0 <= inter_time_ && inter_time_ <= 1;
+	}
+
+	//
+	void CircleRayScalar(uint8_t* hits_, float* inter_time_, const Pt2 pt_, const Vec2 unit_, const float inv_length_,
+		const CircleStream& circles_, size_t begin_, const size_t n_)
+	{
+		for (; begin_ < n_; ++begin_)
+		{
+			const bool hit = CircleRay(pt_, unit_, inv_length_, circles_, begin_, inter_time_[begin_]);
+			if (begin_ % 8 == 0)
+			{ hits_[begin_ / 8] = 0; }
+			hits_[begin_ / 8] |= static_cast<uint8_t>(hit << (begin_ % 8));
+		}
+	}
+
+	// folds circles [begin_, n_) into the nearest hit so far, the lower index on a tie
+	void CircleRayNearestScalar(const Pt2 pt_, const Vec2 unit_, const float inv_length_, const CircleStream& circles_,
+		size_t begin_, const size_t n_, float& inter_time_, size_t& index_)
+	{
+		for (; begin_ < n_; ++begin_)
+		{
+			float t;
+			if (CircleRay(pt_, unit_, inv_length_, circles_, begin_, t) && t < inter_time_)
+			{ inter_time_ = t; index_ = begin_; }
+		}
+	}
+
+	// the points move by vels_ less vel_ against the shape standing still
+	void CirclePointSweepScalar(uint8_t* hits_, float* inter_time_, const Circle& circle_, const Vec2 vel_,
+		const Vec2Stream& points_, const Vec2Stream& vels_, size_t begin_, const size_t n_)
+	{
+		for (; begin_ < n_; ++begin_)
+		{
+			const bool hit = PointCircleSweep(points_.x[begin_], points_.y[begin_], vels_.x[begin_] - vel_.x,
+				vels_.y[begin_] - vel_.y, circle_.center.x, circle_.center.y, circle_.radius, inter_time_[begin_]);
+			if (begin_ % 8 == 0)
+			{ hits_[begin_ / 8] = 0; }
+			hits_[begin_ / 8] |= static_cast<uint8_t>(hit << (begin_ % 8));
+		}
+	}
+
+	//
+	void AABBPointSweepScalar(uint8_t* hits_, float* inter_time_, const AABB& aabb_, const Vec2 vel_,
+		const Vec2Stream& points_, const Vec2Stream& vels_, size_t begin_, const size_t n_)
+	{
+		for (; begin_ < n_; ++begin_)
+		{
+			const bool hit = PointAABBSweep(points_.x[begin_], points_.y[begin_], vels_.x[begin_] - vel_.x,
+				vels_.y[begin_] - vel_.y, aabb_, inter_time_[begin_]);
+			if (begin_ % 8 == 0)
+			{ hits_[begin_ / 8] = 0; }
+			hits_[begin_ / 8] |= static_cast<uint8_t>(hit << (begin_ % 8));
+		}
+	}
+
+	// aabb_ moves by vel_ against boxes_ standing still
+	void AABBSweepScalar(uint8_t* hits_, float* inter_time_, float* normal_x_, float* normal_y_, const AABB& aabb_,
+		const Vec2 vel_, const AABBStream& boxes_, size_t begin_, const size_t n_)
+	{
+		const Vec2 inv_vel(SafeInverse(vel_.x), SafeInverse(vel_.y));
+		for (; begin_ < n_; ++begin_)
+		{
+			float exit{ 0 };
+			Vec2 normal(0, 0);
+			const bool hit = AABBSweep(boxes_.min_x[begin_], boxes_.min_y[begin_], boxes_.max_x[begin_], boxes_.max_y[begin_],
+				aabb_, vel_, inv_vel, inter_time_[begin_], exit, normal);
+			normal_x_[begin_] = normal.x;
+			normal_y_[begin_] = normal.y;
+			if (begin_ % 8 == 0)
+			{ hits_[begin_ / 8] = 0; }
+			hits_[begin_ / 8] |= static_cast<uint8_t>(hit << (begin_ % 8));
+		}
+	}
+
+	//
+	void OBBOBBScalar(uint8_t* hits_, const OBB2D& obb_, const OBB2DStream& boxes_, size_t begin_, const size_t n_)
+	{
+		for (; begin_ < n_; ++begin_)
+		{
+			const bool hit = OBBOBB(obb_, boxes_.Get(begin_), nullptr);
+			if (begin_ % 8 == 0)
+			{ hits_[begin_ / 8] = 0; }
+			hits_[begin_ / 8] |= static_cast<uint8_t>(hit << (begin_ % 8));
+		}
+	}
+
+	#if SIMD_X86
+	/* SSE KERNELS */
+
+	//
+	SIMD_TARGET_SSE size_t CircleLineSegmentSSE(size_t* hits_, const Circle& circle_, const LineSegmentStream& seg_, const size_t n_)
+	{
+		const __m128 cx = _mm_set1_ps(circle_.center.x), cy = _mm_set1_ps(circle_.center.y);
+		const __m128 radius_sq = _mm_set1_ps(circle_.radius * circle_.radius), zero = _mm_setzero_ps();
+		size_t count{ 0 }, i{ 0 };
+		for (; i + 4 <= n_; i += 4)
+		{
+			const __m128 dir_x = _mm_load_ps(seg_.dir_x + i), dir_y = _mm_load_ps(seg_.dir_y + i);
+			const __m128 dx = _mm_sub_ps(cx, _mm_load_ps(seg_.p0_x + i)), dy = _mm_sub_ps(cy, _mm_load_ps(seg_.p0_y + i));
+			const __m128 side = _mm_sub_ps(_mm_sub_ps(_mm_mul_ps(dir_y, cx), _mm_mul_ps(dir_x, cy)), _mm_load_ps(seg_.offset + i));
+			const __m128 along = _mm_add_ps(_mm_mul_ps(dir_x, dx), _mm_mul_ps(dir_y, dy));
+			const __m128 over = _mm_add_ps(_mm_min_ps(along, zero), _mm_max_ps(_mm_sub_ps(along, _mm_load_ps(seg_.length + i)), zero));
+			const __m128 dist_sq = _mm_add_ps(_mm_mul_ps(side, side), _mm_mul_ps(over, over));
+			int mask = _mm_movemask_ps(_mm_cmple_ps(dist_sq, radius_sq));
+			// hits are rare against a level's worth of walls, most blocks skip this
+			for (size_t j{ 0 }; mask; ++j, mask >>= 1)
+			{
+				hits_[count] = i + j;
+				count += mask & 1;
+			}
+		}
+		return CircleLineSegmentScalar(hits_, count, circle_, seg_, i, n_);
+	}
+
+	//
+	SIMD_TARGET_SSE __m128 AABBAABBSSE(const __m128 (&a_)[4], const AABBStream& boxes_, const size_t i_)
+	{
+		const __m128 x = _mm_and_ps(_mm_cmplt_ps(a_[0], _mm_load_ps(boxes_.max_x + i_)), _mm_cmplt_ps(_mm_load_ps(boxes_.min_x + i_), a_[2]));
+		const __m128 y = _mm_and_ps(_mm_cmplt_ps(a_[1], _mm_load_ps(boxes_.max_y + i_)), _mm_cmplt_ps(_mm_load_ps(boxes_.min_y + i_), a_[3]));
+		return _mm_and_ps(x, y);
+	}
+
+	// two blocks of 4 per byte of hits_
+	SIMD_TARGET_SSE void AABBAABBSSE(uint8_t* hits_, const AABB& aabb_, const AABBStream& boxes_, const size_t n_)
+	{
+		const __m128 a[4]{ _mm_set1_ps(aabb_.min.x), _mm_set1_ps(aabb_.min.y), _mm_set1_ps(aabb_.max.x), _mm_set1_ps(aabb_.max.y) };
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const int lo = _mm_movemask_ps(AABBAABBSSE(a, boxes_, i));
+			const int hi = _mm_movemask_ps(AABBAABBSSE(a, boxes_, i + 4));
+			hits_[i / 8] = static_cast<uint8_t>(lo | hi << 4);
+		}
+		AABBAABBScalar(hits_, aabb_, boxes_, i, n_);
+	}
+
+	//
+	SIMD_TARGET_SSE __m128 CircleAABBSSE(const __m128 cx_, const __m128 cy_, const __m128 radius_sq_, const AABBStream& boxes_, const size_t i_)
+	{
+		const __m128 dx = _mm_sub_ps(cx_, _mm_min_ps(_mm_max_ps(cx_, _mm_load_ps(boxes_.min_x + i_)), _mm_load_ps(boxes_.max_x + i_)));
+		const __m128 dy = _mm_sub_ps(cy_, _mm_min_ps(_mm_max_ps(cy_, _mm_load_ps(boxes_.min_y + i_)), _mm_load_ps(boxes_.max_y + i_)));
+		return _mm_cmple_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), radius_sq_);
+	}
+
+	//
+	SIMD_TARGET_SSE void CircleAABBSSE(uint8_t* hits_, const Circle& circle_, const AABBStream& boxes_, const size_t n_)
+	{
+		const __m128 cx = _mm_set1_ps(circle_.center.x), cy = _mm_set1_ps(circle_.center.y);
+		const __m128 radius_sq = _mm_set1_ps(circle_.radius * circle_.radius);
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const int lo = _mm_movemask_ps(CircleAABBSSE(cx, cy, radius_sq, boxes_, i));
+			const int hi = _mm_movemask_ps(CircleAABBSSE(cx, cy, radius_sq, boxes_, i + 4));
+			hits_[i / 8] = static_cast<uint8_t>(lo | hi << 4);
+		}
+		CircleAABBScalar(hits_, circle_, boxes_, i, n_);
+	}
+
+	// CircleAABBContact() on 4 lanes, c_ holds the centers and radii and b_ the boxes'
+	// min x, min y, max x, max y. Stores at out_[0], out_[1], out_[2] + i_ and returns the hit mask
+	SIMD_TARGET_SSE int CircleAABBContactSSE(const __m128 (&c_)[3], const __m128 (&b_)[4], float* const (&out_)[3], const size_t i_)
+	{
+		const __m128 qx = _mm_min_ps(_mm_max_ps(c_[0], b_[0]), b_[2]), qy = _mm_min_ps(_mm_max_ps(c_[1], b_[1]), b_[3]);
+		const __m128 dx = _mm_sub_ps(c_[0], qx), dy = _mm_sub_ps(c_[1], qy);
+		const __m128 dist_sq = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+		const __m128 left = _mm_sub_ps(c_[0], b_[0]), right = _mm_sub_ps(b_[2], c_[0]);
+		const __m128 bottom = _mm_sub_ps(c_[1], b_[1]), top = _mm_sub_ps(b_[3], c_[1]);
+		const __m128 side_x = _mm_min_ps(left, right), side_y = _mm_min_ps(bottom, top);
+		const __m128 inside = _mm_cmpeq_ps(dist_sq, _mm_setzero_ps()), along_x = _mm_cmple_ps(side_x, side_y);
+		const __m128 push_x = _mm_blendv_ps(b_[2], b_[0], _mm_cmplt_ps(left, right));
+		const __m128 push_y = _mm_blendv_ps(b_[3], b_[1], _mm_cmplt_ps(bottom, top));
+		_mm_storeu_ps(out_[0] + i_, _mm_blendv_ps(qx, push_x, _mm_and_ps(inside, along_x)));
+		_mm_storeu_ps(out_[1] + i_, _mm_blendv_ps(qy, push_y, _mm_andnot_ps(along_x, inside)));
+		const __m128 reach = _mm_blendv_ps(_mm_sub_ps(_mm_setzero_ps(), _mm_sqrt_ps(dist_sq)), _mm_min_ps(side_x, side_y), inside);
+		_mm_storeu_ps(out_[2] + i_, _mm_add_ps(c_[2], reach));
+		return _mm_movemask_ps(_mm_cmple_ps(dist_sq, _mm_mul_ps(c_[2], c_[2])));
+	}
+
+	//
+	SIMD_TARGET_SSE void CircleAABBContactSSE(uint8_t* hits_, float* const (&out_)[3], const Circle& circle_,
+		const AABBStream& boxes_, const size_t n_)
+	{
+		const __m128 c[3]{ _mm_set1_ps(circle_.center.x), _mm_set1_ps(circle_.center.y), _mm_set1_ps(circle_.radius) };
+		int masks[2];
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			for (size_t h{ 0 }; h < 2; ++h)
+			{
+				const size_t j = i + 4 * h;
+				const __m128 b[4]{ _mm_load_ps(boxes_.min_x + j), _mm_load_ps(boxes_.min_y + j), _mm_load_ps(boxes_.max_x + j),
+					_mm_load_ps(boxes_.max_y + j) };
+				masks[h] = CircleAABBContactSSE(c, b, out_, j);
+			}
+			hits_[i / 8] = static_cast<uint8_t>(masks[0] | masks[1] << 4);
+		}
+		CircleAABBContactScalar(hits_, out_[0], out_[1], out_[2], circle_, boxes_, i, n_);
+	}
+
+	// b_ holds min x, min y, max x, max y
+	SIMD_TARGET_SSE int CirclesAABBSSE(const __m128 (&b_)[4], const CircleStream& circles_, const size_t i_)
+	{
+		const __m128 cx = _mm_load_ps(circles_.center_x + i_), cy = _mm_load_ps(circles_.center_y + i_);
+		const __m128 radius = _mm_load_ps(circles_.radius + i_);
+		const __m128 dx = _mm_sub_ps(cx, _mm_min_ps(_mm_max_ps(cx, b_[0]), b_[2]));
+		const __m128 dy = _mm_sub_ps(cy, _mm_min_ps(_mm_max_ps(cy, b_[1]), b_[3]));
+		return _mm_movemask_ps(_mm_cmple_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(radius, radius)));
+	}
+
+	//
+	SIMD_TARGET_SSE void CirclesAABBSSE(uint8_t* hits_, const CircleStream& circles_, const AABB& aabb_, const size_t n_)
+	{
+		const __m128 b[4]{ _mm_set1_ps(aabb_.min.x), _mm_set1_ps(aabb_.min.y), _mm_set1_ps(aabb_.max.x), _mm_set1_ps(aabb_.max.y) };
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{ hits_[i / 8] = static_cast<uint8_t>(CirclesAABBSSE(b, circles_, i) | CirclesAABBSSE(b, circles_, i + 4) << 4); }
+		CirclesAABBScalar(hits_, circles_, aabb_, i, n_);
+	}
+
+	//
+	SIMD_TARGET_SSE void CirclesAABBContactSSE(uint8_t* hits_, float* const (&out_)[3], const CircleStream& circles_,
+		const AABB& aabb_, const size_t n_)
+	{
+		const __m128 b[4]{ _mm_set1_ps(aabb_.min.x), _mm_set1_ps(aabb_.min.y), _mm_set1_ps(aabb_.max.x), _mm_set1_ps(aabb_.max.y) };
+		int masks[2];
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			for (size_t h{ 0 }; h < 2; ++h)
+			{
+				const size_t j = i + 4 * h;
+				const __m128 c[3]{ _mm_load_ps(circles_.center_x + j), _mm_load_ps(circles_.center_y + j),
+					_mm_load_ps(circles_.radius + j) };
+				masks[h] = CircleAABBContactSSE(c, b, out_, j);
+			}
+			hits_[i / 8] = static_cast<uint8_t>(masks[0] | masks[1] << 4);
+		}
+		CirclesAABBContactScalar(hits_, out_[0], out_[1], out_[2], circles_, aabb_, i, n_);
+	}
+
+	// CircleRay() on 4 circles, r_ holds the ray's point, unit direction and 1 / length.
+	// Returns the hit mask and leaves t_ unset when every lane is rejected before the square root
+	SIMD_TARGET_SSE __m128 CircleRaySSE(const __m128 (&r_)[5], const CircleStream& circles_, const size_t i_, __m128& t_)
+	{
+		const __m128 bx = _mm_sub_ps(_mm_load_ps(circles_.center_x + i_), r_[0]);
+		const __m128 by = _mm_sub_ps(_mm_load_ps(circles_.center_y + i_), r_[1]);
+		const __m128 radius = _mm_load_ps(circles_.radius + i_), radius_sq = _mm_mul_ps(radius, radius);
+		const __m128 m = _mm_add_ps(_mm_mul_ps(r_[2], bx), _mm_mul_ps(r_[3], by));
+		const __m128 dist_sq = _mm_add_ps(_mm_mul_ps(bx, bx), _mm_mul_ps(by, by));
+		const __m128 n_sq = _mm_sub_ps(dist_sq, _mm_mul_ps(m, m));
+		const __m128 behind = _mm_and_ps(_mm_cmplt_ps(m, _mm_setzero_ps()), _mm_cmpgt_ps(dist_sq, radius_sq));
+		const __m128 live = _mm_andnot_ps(behind, _mm_cmple_ps(n_sq, radius_sq));
+		if (_mm_movemask_ps(live) == 0)
+		{ return live; }
+		t_ = _mm_mul_ps(_mm_sub_ps(m, _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(radius_sq, n_sq), _mm_setzero_ps()))), r_[4]);
+		return _mm_and_ps(live, _mm_and_ps(_mm_cmpge_ps(t_, _mm_setzero_ps()), _mm_cmple_ps(t_, _mm_set1_ps(1))));
+	}
+
+	//
+	SIMD_TARGET_SSE void CircleRaySSE(uint8_t* hits_, float* inter_time_, const Pt2 pt_, const Vec2 unit_, const float inv_length_,
+		const CircleStream& circles_, const size_t n_)
+	{
+		const __m128 r[5]{ _mm_set1_ps(pt_.x), _mm_set1_ps(pt_.y), _mm_set1_ps(unit_.x), _mm_set1_ps(unit_.y),
+			_mm_set1_ps(inv_length_) };
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			int masks[2];
+			for (size_t h{ 0 }; h < 2; ++h)
+			{
+				__m128 t;
+				masks[h] = _mm_movemask_ps(CircleRaySSE(r, circles_, i + 4 * h, t));
+				if (masks[h])
+				{ _mm_storeu_ps(inter_time_ + i + 4 * h, t); }
+			}
+			hits_[i / 8] = static_cast<uint8_t>(masks[0] | masks[1] << 4);
+		}
+		CircleRayScalar(hits_, inter_time_, pt_, unit_, inv_length_, circles_, i, n_);
+	}
+
+	// per-lane nearest time and index, reduced across the lanes at the end
+	SIMD_TARGET_SSE void CircleRayNearestSSE(const Pt2 pt_, const Vec2 unit_, const float inv_length_,
+		const CircleStream& circles_, const size_t n_, float& inter_time_, size_t& index_)
+	{
+		const __m128 r[5]{ _mm_set1_ps(pt_.x), _mm_set1_ps(pt_.y), _mm_set1_ps(unit_.x), _mm_set1_ps(unit_.y),
+			_mm_set1_ps(inv_length_) };
+		__m128 best_t = _mm_set1_ps(FLT_MAX);
+		__m128i best_i = _mm_setzero_si128(), index = _mm_setr_epi32(0, 1, 2, 3);
+		const __m128i step = _mm_set1_epi32(4);
+		size_t i{ 0 };
+		for (; i + 4 <= n_; i += 4, index = _mm_add_epi32(index, step))
+		{
+			__m128 t;
+			const __m128 hit = CircleRaySSE(r, circles_, i, t);
+			if (_mm_movemask_ps(hit) == 0)
+			{ continue; }
+			const __m128 closer = _mm_and_ps(hit, _mm_cmplt_ps(t, best_t));
+			best_t = _mm_blendv_ps(best_t, t, closer);
+			best_i = _mm_blendv_epi8(best_i, index, _mm_castps_si128(closer));
+		}
+
+		alignas(16) float lane_t[4];
+		alignas(16) int32_t lane_i[4];
+		_mm_store_ps(lane_t, best_t);
+		_mm_store_si128(reinterpret_cast<__m128i*>(lane_i), best_i);
+		for (size_t lane{ 0 }; lane < 4; ++lane)
+		{
+			const size_t lane_index = static_cast<size_t>(lane_i[lane]);
+			if (lane_t[lane] < inter_time_ || (lane_t[lane] == inter_time_ && lane_t[lane] < FLT_MAX && lane_index < index_))
+			{ inter_time_ = lane_t[lane]; index_ = lane_index; }
+		}
+		CircleRayNearestScalar(pt_, unit_, inv_length_, circles_, i, n_, inter_time_, index_);
+	}
+
+	// PointCircleSweep() without the branches, s_ holds the circle's center, radius and velocity
+	SIMD_TARGET_SSE __m128 CirclePointSweepSSE(float* inter_time_, const __m128 (&s_)[5], const Vec2Stream& points_,
+		const Vec2Stream& vels_, const size_t i_)
+	{
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 mx = _mm_sub_ps(_mm_load_ps(points_.x + i_), s_[0]), my = _mm_sub_ps(_mm_load_ps(points_.y + i_), s_[1]);
+		const __m128 vx = _mm_sub_ps(_mm_load_ps(vels_.x + i_), s_[3]), vy = _mm_sub_ps(_mm_load_ps(vels_.y + i_), s_[4]);
+		const __m128 a = _mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy));
+		const __m128 b = _mm_add_ps(_mm_mul_ps(mx, vx), _mm_mul_ps(my, vy));
+		const __m128 c = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(mx, mx), _mm_mul_ps(my, my)), _mm_mul_ps(s_[2], s_[2]));
+		const __m128 disc = _mm_sub_ps(_mm_mul_ps(b, b), _mm_mul_ps(a, c));
+		const __m128 inside = _mm_cmplt_ps(c, zero);
+		const __m128 t = _mm_div_ps(_mm_sub_ps(_mm_sub_ps(zero, b), _mm_sqrt_ps(_mm_max_ps(disc, zero))), a);
+		_mm_storeu_ps(inter_time_ + i_, _mm_andnot_ps(inside, t));
+		const __m128 ahead = _mm_and_ps(_mm_and_ps(_mm_cmplt_ps(b, zero), _mm_cmpge_ps(disc, zero)), _mm_cmple_ps(t, _mm_set1_ps(1)));
+		return _mm_or_ps(inside, ahead);
+	}
+
+	//
+	SIMD_TARGET_SSE void CirclePointSweepSSE(uint8_t* hits_, float* inter_time_, const Circle& circle_, const Vec2 vel_,
+		const Vec2Stream& points_, const Vec2Stream& vels_, const size_t n_)
+	{
+		const __m128 s[5]{ _mm_set1_ps(circle_.center.x), _mm_set1_ps(circle_.center.y), _mm_set1_ps(circle_.radius),
+			_mm_set1_ps(vel_.x), _mm_set1_ps(vel_.y) };
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const int lo = _mm_movemask_ps(CirclePointSweepSSE(inter_time_, s, points_, vels_, i));
+			const int hi = _mm_movemask_ps(CirclePointSweepSSE(inter_time_, s, points_, vels_, i + 4));
+			hits_[i / 8] = static_cast<uint8_t>(lo | hi << 4);
+		}
+		CirclePointSweepScalar(hits_, inter_time_, circle_, vel_, points_, vels_, i, n_);
+	}
+
+	// SafeInverse() on 4 lanes
+	SIMD_TARGET_SSE __m128 SafeInverseSSE(const __m128 vel_)
+	{
+		const __m128 sign = _mm_set1_ps(-0.0f), tiny = _mm_set1_ps(SLAB_TINY);
+		const __m128 small = _mm_cmplt_ps(_mm_andnot_ps(sign, vel_), tiny);
+		return _mm_div_ps(_mm_set1_ps(1), _mm_blendv_ps(vel_, _mm_or_ps(tiny, _mm_and_ps(sign, vel_)), small));
+	}
+
+	// PointAABBSweep() without the branches, b_ holds min x, min y, max x, max y and the box's velocity
+	SIMD_TARGET_SSE __m128 AABBPointSweepSSE(float* inter_time_, const __m128 (&b_)[6], const Vec2Stream& points_,
+		const Vec2Stream& vels_, const size_t i_)
+	{
+		const __m128 px = _mm_load_ps(points_.x + i_), py = _mm_load_ps(points_.y + i_);
+		const __m128 inv_x = SafeInverseSSE(_mm_sub_ps(_mm_load_ps(vels_.x + i_), b_[4]));
+		const __m128 inv_y = SafeInverseSSE(_mm_sub_ps(_mm_load_ps(vels_.y + i_), b_[5]));
+		const __m128 tx0 = _mm_mul_ps(_mm_sub_ps(b_[0], px), inv_x), tx1 = _mm_mul_ps(_mm_sub_ps(b_[2], px), inv_x);
+		const __m128 ty0 = _mm_mul_ps(_mm_sub_ps(b_[1], py), inv_y), ty1 = _mm_mul_ps(_mm_sub_ps(b_[3], py), inv_y);
+		const __m128 enter = _mm_max_ps(_mm_max_ps(_mm_min_ps(tx0, tx1), _mm_min_ps(ty0, ty1)), _mm_setzero_ps());
+		const __m128 exit = _mm_min_ps(_mm_min_ps(_mm_max_ps(tx0, tx1), _mm_max_ps(ty0, ty1)), _mm_set1_ps(1));
+		_mm_storeu_ps(inter_time_ + i_, enter);
+		return _mm_cmple_ps(enter, exit);
+	}
+
+	//
+	SIMD_TARGET_SSE void AABBPointSweepSSE(uint8_t* hits_, float* inter_time_, const AABB& aabb_, const Vec2 vel_,
+		const Vec2Stream& points_, const Vec2Stream& vels_, const size_t n_)
+	{
+		const __m128 b[6]{ _mm_set1_ps(aabb_.min.x), _mm_set1_ps(aabb_.min.y), _mm_set1_ps(aabb_.max.x), _mm_set1_ps(aabb_.max.y),
+			_mm_set1_ps(vel_.x), _mm_set1_ps(vel_.y) };
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const int lo = _mm_movemask_ps(AABBPointSweepSSE(inter_time_, b, points_, vels_, i));
+			const int hi = _mm_movemask_ps(AABBPointSweepSSE(inter_time_, b, points_, vels_, i + 4));
+			hits_[i / 8] = static_cast<uint8_t>(lo | hi << 4);
+		}
+		AABBPointSweepScalar(hits_, inter_time_, aabb_, vel_, points_, vels_, i, n_);
+	}
+
+	// AxisSweep() on 4 still boxes. vel_ is the same for every lane, s_ holds its inverse,
+	// the moving box's min and max, a mask of whether it stands still and the normal the axis gives
+	SIMD_TARGET_SSE void AxisSweepSSE(const __m128 min_, const __m128 max_, const __m128 (&s_)[5], __m128& enter_, __m128& exit_)
+	{
+		const __m128 t0 = _mm_mul_ps(_mm_sub_ps(min_, s_[2]), s_[0]), t1 = _mm_mul_ps(_mm_sub_ps(max_, s_[1]), s_[0]);
+		const __m128 overlap = _mm_and_ps(_mm_cmplt_ps(min_, s_[2]), _mm_cmplt_ps(s_[1], max_));
+		const __m128 still_enter = _mm_blendv_ps(_mm_set1_ps(FLT_MAX), _mm_set1_ps(-FLT_MAX), overlap);
+		enter_ = _mm_blendv_ps(_mm_min_ps(t0, t1), still_enter, s_[3]);
+		exit_ = _mm_blendv_ps(_mm_max_ps(t0, t1), _mm_xor_ps(still_enter, _mm_set1_ps(-0.0f)), s_[3]);
+	}
+
+	//
+	SIMD_TARGET_SSE __m128 AABBSweepSSE(float* inter_time_, float* normal_x_, float* normal_y_, const __m128 (&x_)[5],
+		const __m128 (&y_)[5], const AABBStream& boxes_, const size_t i_)
+	{
+		const __m128 zero = _mm_setzero_ps();
+		__m128 enter_x, exit_x, enter_y, exit_y;
+		AxisSweepSSE(_mm_load_ps(boxes_.min_x + i_), _mm_load_ps(boxes_.max_x + i_), x_, enter_x, exit_x);
+		AxisSweepSSE(_mm_load_ps(boxes_.min_y + i_), _mm_load_ps(boxes_.max_y + i_), y_, enter_y, exit_y);
+		const __m128 enter = _mm_max_ps(enter_x, enter_y), exit = _mm_min_ps(exit_x, exit_y);
+		const __m128 entering = _mm_cmpge_ps(enter, zero), along_x = _mm_cmpge_ps(enter_x, enter_y);
+		_mm_storeu_ps(inter_time_ + i_, _mm_max_ps(enter, zero));
+		_mm_storeu_ps(normal_x_ + i_, _mm_and_ps(_mm_and_ps(entering, along_x), x_[4]));
+		_mm_storeu_ps(normal_y_ + i_, _mm_and_ps(_mm_andnot_ps(along_x, entering), y_[4]));
+		return _mm_and_ps(_mm_and_ps(_mm_cmplt_ps(enter, exit), _mm_cmplt_ps(enter, _mm_set1_ps(1))), _mm_cmpgt_ps(exit, zero));
+	}
+
+	//
+	SIMD_TARGET_SSE void AABBSweepSSE(uint8_t* hits_, float* inter_time_, float* normal_x_, float* normal_y_, const AABB& aabb_,
+		const Vec2 vel_, const AABBStream& boxes_, const size_t n_)
+	{
+		const Vec2 inv_vel(SafeInverse(vel_.x), SafeInverse(vel_.y));
+		const __m128 x[5]{ _mm_set1_ps(inv_vel.x), _mm_set1_ps(aabb_.min.x), _mm_set1_ps(aabb_.max.x),
+			_mm_castsi128_ps(_mm_set1_epi32(fabsf(vel_.x) < SLAB_TINY ? -1 : 0)), _mm_set1_ps(vel_.x > 0 ? -1.0f : 1.0f) };
+		const __m128 y[5]{ _mm_set1_ps(inv_vel.y), _mm_set1_ps(aabb_.min.y), _mm_set1_ps(aabb_.max.y),
+			_mm_castsi128_ps(_mm_set1_epi32(fabsf(vel_.y) < SLAB_TINY ? -1 : 0)), _mm_set1_ps(vel_.y > 0 ? -1.0f : 1.0f) };
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const int lo = _mm_movemask_ps(AABBSweepSSE(inter_time_, normal_x_, normal_y_, x, y, boxes_, i));
+			const int hi = _mm_movemask_ps(AABBSweepSSE(inter_time_, normal_x_, normal_y_, x, y, boxes_, i + 4));
+			hits_[i / 8] = static_cast<uint8_t>(lo | hi << 4);
+		}
+		AABBSweepScalar(hits_, inter_time_, normal_x_, normal_y_, aabb_, vel_, boxes_, i, n_);
+	}
+
+	// c_ holds the center and the radius, touching does not count
+	SIMD_TARGET_SSE __m128 CircleCircleSSE(const __m128 (&c_)[3], const __m128 x_, const __m128 y_, const __m128 radius_)
+	{
+		const __m128 dx = _mm_sub_ps(x_, c_[0]), dy = _mm_sub_ps(y_, c_[1]);
+		const __m128 sum = _mm_add_ps(radius_, c_[2]);
+		return _mm_cmpgt_ps(_mm_mul_ps(sum, sum), _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)));
+	}
+
+	//
+	SIMD_TARGET_SSE int CircleCircleSSE(const __m128 (&c_)[3], const CircleStream& circles_, const size_t i_)
+	{
+		return _mm_movemask_ps(CircleCircleSSE(c_, _mm_load_ps(circles_.center_x + i_), _mm_load_ps(circles_.center_y + i_),
+			_mm_load_ps(circles_.radius + i_)));
+	}
+
+	//
+	SIMD_TARGET_SSE void CircleCircleSSE(uint8_t* hits_, const Circle& circle_, const CircleStream& circles_, const size_t n_)
+	{
+		const __m128 c[3]{ _mm_set1_ps(circle_.center.x), _mm_set1_ps(circle_.center.y), _mm_set1_ps(circle_.radius) };
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{ hits_[i / 8] = static_cast<uint8_t>(CircleCircleSSE(c, circles_, i) | CircleCircleSSE(c, circles_, i + 4) << 4); }
+		CircleCircleScalar(hits_, circle_, circles_, i, n_);
+	}
+
+	//
+	SIMD_TARGET_SSE size_t CircleCircleSSE(size_t* hits_, const Circle& circle_, const CircleStream& circles_, const size_t n_)
+	{
+		const __m128 c[3]{ _mm_set1_ps(circle_.center.x), _mm_set1_ps(circle_.center.y), _mm_set1_ps(circle_.radius) };
+		size_t count{ 0 }, i{ 0 };
+		for (; i + 4 <= n_; i += 4)
+		{
+			int mask = CircleCircleSSE(c, circles_, i);
+			for (size_t j{ 0 }; mask; ++j, mask >>= 1)
+			{
+				hits_[count] = i + j;
+				count += mask & 1;
+			}
+		}
+		return CircleCircleScalar(hits_, count, circle_, circles_, i, n_);
+	}
+
+	// tiles of 4 rows against blocks of 4 columns, so each column load serves 4 rows.
+	// Columns start at the aligned block holding the tile's first row + 1
+	SIMD_TARGET_SSE size_t CircleCirclePairsSSE(size_t* pairs_, const CircleStream& circles_, const size_t n_)
+	{
+		constexpr size_t TILE = 4;
+		size_t count{ 0 }, i{ 0 };
+		for (; i + TILE <= n_; i += TILE)
+		{
+			__m128 rows[TILE][3];
+			for (size_t t{ 0 }; t < TILE; ++t)
+			{
+				rows[t][0] = _mm_set1_ps(circles_.center_x[i + t]);
+				rows[t][1] = _mm_set1_ps(circles_.center_y[i + t]);
+				rows[t][2] = _mm_set1_ps(circles_.radius[i + t]);
+			}
+			for (size_t j{ (i + 1) / 4 * 4 }; j < n_; j += 4)
+			{
+				const __m128 x = _mm_load_ps(circles_.center_x + j), y = _mm_load_ps(circles_.center_y + j);
+				const __m128 radius = _mm_load_ps(circles_.radius + j);
+				for (size_t t{ 0 }; t < TILE; ++t)
+				{
+					const int mask = _mm_movemask_ps(CircleCircleSSE(rows[t], x, y, radius)) & PairLanes(i + t, j, n_, 4);
+					count = EmitPairs(pairs_, count, i + t, j, mask);
+				}
+			}
+		}
+		return CircleCirclePairsScalar(pairs_, count, circles_, i, n_);
+	}
+
+	// the four axis tests of OBBAxes() for boxes i_ to i_ + 3
+	SIMD_TARGET_SSE __m128 OBBOBBSSE(const __m128 (&a_)[6], const OBB2DStream& boxes_, const size_t i_)
+	{
+		const __m128 sign = _mm_set1_ps(-0.0f);
+		const __m128 cb = _mm_load_ps(boxes_.rot_c + i_), sb = _mm_load_ps(boxes_.rot_s + i_);
+		const __m128 hbx = _mm_load_ps(boxes_.half_x + i_), hby = _mm_load_ps(boxes_.half_y + i_);
+		const __m128 dx = _mm_sub_ps(_mm_load_ps(boxes_.center_x + i_), a_[0]);
+		const __m128 dy = _mm_sub_ps(_mm_load_ps(boxes_.center_y + i_), a_[1]);
+		const __m128 cr = _mm_andnot_ps(sign, _mm_add_ps(_mm_mul_ps(a_[4], cb), _mm_mul_ps(a_[5], sb)));
+		const __m128 sr = _mm_andnot_ps(sign, _mm_sub_ps(_mm_mul_ps(a_[5], cb), _mm_mul_ps(a_[4], sb)));
+
+		const __m128 du0 = _mm_andnot_ps(sign, _mm_add_ps(_mm_mul_ps(dx, a_[4]), _mm_mul_ps(dy, a_[5])));
+		const __m128 du1 = _mm_andnot_ps(sign, _mm_sub_ps(_mm_mul_ps(dy, a_[4]), _mm_mul_ps(dx, a_[5])));
+		const __m128 dv0 = _mm_andnot_ps(sign, _mm_add_ps(_mm_mul_ps(dx, cb), _mm_mul_ps(dy, sb)));
+		const __m128 dv1 = _mm_andnot_ps(sign, _mm_sub_ps(_mm_mul_ps(dy, cb), _mm_mul_ps(dx, sb)));
+
+		const __m128 r0 = _mm_add_ps(a_[2], _mm_add_ps(_mm_mul_ps(hbx, cr), _mm_mul_ps(hby, sr)));
+		const __m128 r1 = _mm_add_ps(a_[3], _mm_add_ps(_mm_mul_ps(hbx, sr), _mm_mul_ps(hby, cr)));
+		const __m128 r2 = _mm_add_ps(hbx, _mm_add_ps(_mm_mul_ps(a_[2], cr), _mm_mul_ps(a_[3], sr)));
+		const __m128 r3 = _mm_add_ps(hby, _mm_add_ps(_mm_mul_ps(a_[2], sr), _mm_mul_ps(a_[3], cr)));
+		return _mm_and_ps(_mm_and_ps(_mm_cmplt_ps(du0, r0), _mm_cmplt_ps(du1, r1)),
+			_mm_and_ps(_mm_cmplt_ps(dv0, r2), _mm_cmplt_ps(dv1, r3)));
+	}
+
+	//
+	SIMD_TARGET_SSE void OBBOBBSSE(uint8_t* hits_, const OBB2D& obb_, const OBB2DStream& boxes_, const size_t n_)
+	{
+		const __m128 a[6]{ _mm_set1_ps(obb_.center.x), _mm_set1_ps(obb_.center.y), _mm_set1_ps(obb_.half_ext.x),
+			_mm_set1_ps(obb_.half_ext.y), _mm_set1_ps(obb_.rot.c), _mm_set1_ps(obb_.rot.s) };
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const int lo = _mm_movemask_ps(OBBOBBSSE(a, boxes_, i));
+			const int hi = _mm_movemask_ps(OBBOBBSSE(a, boxes_, i + 4));
+			hits_[i / 8] = static_cast<uint8_t>(lo | hi << 4);
+		}
+		OBBOBBScalar(hits_, obb_, boxes_, i, n_);
+	}
+
+	/* AVX2 KERNELS */
+
+	//
+	SIMD_TARGET_AVX2 size_t CircleLineSegmentAVX2(size_t* hits_, const Circle& circle_, const LineSegmentStream& seg_, const size_t n_)
+	{
+		const __m256 cx = _mm256_set1_ps(circle_.center.x), cy = _mm256_set1_ps(circle_.center.y);
+		const __m256 radius_sq = _mm256_set1_ps(circle_.radius * circle_.radius), zero = _mm256_setzero_ps();
+		size_t count{ 0 }, i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const __m256 dir_x = _mm256_load_ps(seg_.dir_x + i), dir_y = _mm256_load_ps(seg_.dir_y + i);
+			const __m256 dx = _mm256_sub_ps(cx, _mm256_load_ps(seg_.p0_x + i)), dy = _mm256_sub_ps(cy, _mm256_load_ps(seg_.p0_y + i));
+			const __m256 side = _mm256_sub_ps(_mm256_fmsub_ps(dir_y, cx, _mm256_mul_ps(dir_x, cy)), _mm256_load_ps(seg_.offset + i));
+			const __m256 along = _mm256_fmadd_ps(dir_x, dx, _mm256_mul_ps(dir_y, dy));
+			const __m256 over = _mm256_add_ps(_mm256_min_ps(along, zero),
+				_mm256_max_ps(_mm256_sub_ps(along, _mm256_load_ps(seg_.length + i)), zero));
+			const __m256 dist_sq = _mm256_fmadd_ps(side, side, _mm256_mul_ps(over, over));
+			int mask = _mm256_movemask_ps(_mm256_cmp_ps(dist_sq, radius_sq, _CMP_LE_OQ));
+			for (size_t j{ 0 }; mask; ++j, mask >>= 1)
+			{
+				hits_[count] = i + j;
+				count += mask & 1;
+			}
+		}
+		return CircleLineSegmentScalar(hits_, count, circle_, seg_, i, n_);
+	}
+
+	// one byte of hits_ per iteration
+	SIMD_TARGET_AVX2 void AABBAABBAVX2(uint8_t* hits_, const AABB& aabb_, const AABBStream& boxes_, const size_t n_)
+	{
+		const __m256 min_x = _mm256_set1_ps(aabb_.min.x), min_y = _mm256_set1_ps(aabb_.min.y);
+		const __m256 max_x = _mm256_set1_ps(aabb_.max.x), max_y = _mm256_set1_ps(aabb_.max.y);
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const __m256 x = _mm256_and_ps(_mm256_cmp_ps(min_x, _mm256_load_ps(boxes_.max_x + i), _CMP_LT_OQ),
+				_mm256_cmp_ps(_mm256_load_ps(boxes_.min_x + i), max_x, _CMP_LT_OQ));
+			const __m256 y = _mm256_and_ps(_mm256_cmp_ps(min_y, _mm256_load_ps(boxes_.max_y + i), _CMP_LT_OQ),
+				_mm256_cmp_ps(_mm256_load_ps(boxes_.min_y + i), max_y, _CMP_LT_OQ));
+			hits_[i / 8] = static_cast<uint8_t>(_mm256_movemask_ps(_mm256_and_ps(x, y)));
+		}
+		AABBAABBScalar(hits_, aabb_, boxes_, i, n_);
+	}
+
+	//
+	SIMD_TARGET_AVX2 void CircleAABBAVX2(uint8_t* hits_, const Circle& circle_, const AABBStream& boxes_, const size_t n_)
+	{
+		const __m256 cx = _mm256_set1_ps(circle_.center.x), cy = _mm256_set1_ps(circle_.center.y);
+		const __m256 radius_sq = _mm256_set1_ps(circle_.radius * circle_.radius);
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const __m256 dx = _mm256_sub_ps(cx, _mm256_min_ps(_mm256_max_ps(cx, _mm256_load_ps(boxes_.min_x + i)), _mm256_load_ps(boxes_.max_x + i)));
+			const __m256 dy = _mm256_sub_ps(cy, _mm256_min_ps(_mm256_max_ps(cy, _mm256_load_ps(boxes_.min_y + i)), _mm256_load_ps(boxes_.max_y + i)));
+			const __m256 dist_sq = _mm256_fmadd_ps(dx, dx, _mm256_mul_ps(dy, dy));
+			hits_[i / 8] = static_cast<uint8_t>(_mm256_movemask_ps(_mm256_cmp_ps(dist_sq, radius_sq, _CMP_LE_OQ)));
+		}
+		CircleAABBScalar(hits_, circle_, boxes_, i, n_);
+	}
+
+	// same as CircleAABBContactSSE(), 8 lanes
+	SIMD_TARGET_AVX2 int CircleAABBContactAVX2(const __m256 (&c_)[3], const __m256 (&b_)[4], float* const (&out_)[3],
+		const size_t i_)
+	{
+		const __m256 qx = _mm256_min_ps(_mm256_max_ps(c_[0], b_[0]), b_[2]), qy = _mm256_min_ps(_mm256_max_ps(c_[1], b_[1]), b_[3]);
+		const __m256 dx = _mm256_sub_ps(c_[0], qx), dy = _mm256_sub_ps(c_[1], qy);
+		const __m256 dist_sq = _mm256_fmadd_ps(dx, dx, _mm256_mul_ps(dy, dy));
+		const __m256 left = _mm256_sub_ps(c_[0], b_[0]), right = _mm256_sub_ps(b_[2], c_[0]);
+		const __m256 bottom = _mm256_sub_ps(c_[1], b_[1]), top = _mm256_sub_ps(b_[3], c_[1]);
+		const __m256 side_x = _mm256_min_ps(left, right), side_y = _mm256_min_ps(bottom, top);
+		const __m256 inside = _mm256_cmp_ps(dist_sq, _mm256_setzero_ps(), _CMP_EQ_OQ);
+		const __m256 along_x = _mm256_cmp_ps(side_x, side_y, _CMP_LE_OQ);
+		const __m256 push_x = _mm256_blendv_ps(b_[2], b_[0], _mm256_cmp_ps(left, right, _CMP_LT_OQ));
+		const __m256 push_y = _mm256_blendv_ps(b_[3], b_[1], _mm256_cmp_ps(bottom, top, _CMP_LT_OQ));
+		_mm256_storeu_ps(out_[0] + i_, _mm256_blendv_ps(qx, push_x, _mm256_and_ps(inside, along_x)));
+		_mm256_storeu_ps(out_[1] + i_, _mm256_blendv_ps(qy, push_y, _mm256_andnot_ps(along_x, inside)));
+		const __m256 reach = _mm256_blendv_ps(_mm256_sub_ps(_mm256_setzero_ps(), _mm256_sqrt_ps(dist_sq)),
+			_mm256_min_ps(side_x, side_y), inside);
+		_mm256_storeu_ps(out_[2] + i_, _mm256_add_ps(c_[2], reach));
+		return _mm256_movemask_ps(_mm256_cmp_ps(dist_sq, _mm256_mul_ps(c_[2], c_[2]), _CMP_LE_OQ));
+	}
+
+	//
+	SIMD_TARGET_AVX2 void CircleAABBContactAVX2(uint8_t* hits_, float* const (&out_)[3], const Circle& circle_,
+		const AABBStream& boxes_, const size_t n_)
+	{
+		const __m256 c[3]{ _mm256_set1_ps(circle_.center.x), _mm256_set1_ps(circle_.center.y), _mm256_set1_ps(circle_.radius) };
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const __m256 b[4]{ _mm256_load_ps(boxes_.min_x + i), _mm256_load_ps(boxes_.min_y + i), _mm256_load_ps(boxes_.max_x + i),
+				_mm256_load_ps(boxes_.max_y + i) };
+			hits_[i / 8] = static_cast<uint8_t>(CircleAABBContactAVX2(c, b, out_, i));
+		}
+		CircleAABBContactScalar(hits_, out_[0], out_[1], out_[2], circle_, boxes_, i, n_);
+	}
+
+	//
+	SIMD_TARGET_AVX2 void CirclesAABBAVX2(uint8_t* hits_, const CircleStream& circles_, const AABB& aabb_, const size_t n_)
+	{
+		const __m256 min_x = _mm256_set1_ps(aabb_.min.x), min_y = _mm256_set1_ps(aabb_.min.y);
+		const __m256 max_x = _mm256_set1_ps(aabb_.max.x), max_y = _mm256_set1_ps(aabb_.max.y);
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const __m256 cx = _mm256_load_ps(circles_.center_x + i), cy = _mm256_load_ps(circles_.center_y + i);
+			const __m256 radius = _mm256_load_ps(circles_.radius + i);
+			const __m256 dx = _mm256_sub_ps(cx, _mm256_min_ps(_mm256_max_ps(cx, min_x), max_x));
+			const __m256 dy = _mm256_sub_ps(cy, _mm256_min_ps(_mm256_max_ps(cy, min_y), max_y));
+			const __m256 dist_sq = _mm256_fmadd_ps(dx, dx, _mm256_mul_ps(dy, dy));
+			hits_[i / 8] = static_cast<uint8_t>(_mm256_movemask_ps(_mm256_cmp_ps(dist_sq, _mm256_mul_ps(radius, radius), _CMP_LE_OQ)));
+		}
+		CirclesAABBScalar(hits_, circles_, aabb_, i, n_);
+	}
+
+	//
+	SIMD_TARGET_AVX2 void CirclesAABBContactAVX2(uint8_t* hits_, float* const (&out_)[3], const CircleStream& circles_,
+		const AABB& aabb_, const size_t n_)
+	{
+		const __m256 b[4]{ _mm256_set1_ps(aabb_.min.x), _mm256_set1_ps(aabb_.min.y), _mm256_set1_ps(aabb_.max.x),
+			_mm256_set1_ps(aabb_.max.y) };
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const __m256 c[3]{ _mm256_load_ps(circles_.center_x + i), _mm256_load_ps(circles_.center_y + i),
+				_mm256_load_ps(circles_.radius + i) };
+			hits_[i / 8] = static_cast<uint8_t>(CircleAABBContactAVX2(c, b, out_, i));
+		}
+		CirclesAABBContactScalar(hits_, out_[0], out_[1], out_[2], circles_, aabb_, i, n_);
+	}
+
+	// same as CircleRaySSE(), 8 circles
+	SIMD_TARGET_AVX2 __m256 CircleRayAVX2(const __m256 (&r_)[5], const CircleStream& circles_, const size_t i_, __m256& t_)
+	{
+		const __m256 zero = _mm256_setzero_ps();
+		const __m256 bx = _mm256_sub_ps(_mm256_load_ps(circles_.center_x + i_), r_[0]);
+		const __m256 by = _mm256_sub_ps(_mm256_load_ps(circles_.center_y + i_), r_[1]);
+		const __m256 radius = _mm256_load_ps(circles_.radius + i_), radius_sq = _mm256_mul_ps(radius, radius);
+		const __m256 m = _mm256_fmadd_ps(r_[2], bx, _mm256_mul_ps(r_[3], by));
+		const __m256 dist_sq = _mm256_fmadd_ps(bx, bx, _mm256_mul_ps(by, by));
+		const __m256 n_sq = _mm256_fnmadd_ps(m, m, dist_sq);
+		const __m256 behind = _mm256_and_ps(_mm256_cmp_ps(m, zero, _CMP_LT_OQ), _mm256_cmp_ps(dist_sq, radius_sq, _CMP_GT_OQ));
+		const __m256 live = _mm256_andnot_ps(behind, _mm256_cmp_ps(n_sq, radius_sq, _CMP_LE_OQ));
+		if (_mm256_movemask_ps(live) == 0)
+		{ return live; }
+		t_ = _mm256_mul_ps(_mm256_sub_ps(m, _mm256_sqrt_ps(_mm256_max_ps(_mm256_sub_ps(radius_sq, n_sq), zero))), r_[4]);
+		return _mm256_and_ps(live, _mm256_and_ps(_mm256_cmp_ps(t_, zero, _CMP_GE_OQ), _mm256_cmp_ps(t_, _mm256_set1_ps(1), _CMP_LE_OQ)));
+	}
+
+	//
+	SIMD_TARGET_AVX2 void CircleRayAVX2(uint8_t* hits_, float* inter_time_, const Pt2 pt_, const Vec2 unit_, const float inv_length_,
+		const CircleStream& circles_, const size_t n_)
+	{
+		const __m256 r[5]{ _mm256_set1_ps(pt_.x), _mm256_set1_ps(pt_.y), _mm256_set1_ps(unit_.x), _mm256_set1_ps(unit_.y),
+			_mm256_set1_ps(inv_length_) };
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			__m256 t;
+			const int mask = _mm256_movemask_ps(CircleRayAVX2(r, circles_, i, t));
+			if (mask)
+			{ _mm256_storeu_ps(inter_time_ + i, t); }
+			hits_[i / 8] = static_cast<uint8_t>(mask);
+		}
+		CircleRayScalar(hits_, inter_time_, pt_, unit_, inv_length_, circles_, i, n_);
+	}
+
+	// same as CircleRayNearestSSE(), 8 lanes
+	SIMD_TARGET_AVX2 void CircleRayNearestAVX2(const Pt2 pt_, const Vec2 unit_, const float inv_length_,
+		const CircleStream& circles_, const size_t n_, float& inter_time_, size_t& index_)
+	{
+		const __m256 r[5]{ _mm256_set1_ps(pt_.x), _mm256_set1_ps(pt_.y), _mm256_set1_ps(unit_.x), _mm256_set1_ps(unit_.y),
+			_mm256_set1_ps(inv_length_) };
+		__m256 best_t = _mm256_set1_ps(FLT_MAX);
+		__m256i best_i = _mm256_setzero_si256(), index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+		const __m256i step = _mm256_set1_epi32(8);
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8, index = _mm256_add_epi32(index, step))
+		{
+			__m256 t;
+			const __m256 hit = CircleRayAVX2(r, circles_, i, t);
+			if (_mm256_movemask_ps(hit) == 0)
+			{ continue; }
+			const __m256 closer = _mm256_and_ps(hit, _mm256_cmp_ps(t, best_t, _CMP_LT_OQ));
+			best_t = _mm256_blendv_ps(best_t, t, closer);
+			best_i = _mm256_blendv_epi8(best_i, index, _mm256_castps_si256(closer));
+		}
+
+		alignas(32) float lane_t[8];
+		alignas(32) int32_t lane_i[8];
+		_mm256_store_ps(lane_t, best_t);
+		_mm256_store_si256(reinterpret_cast<__m256i*>(lane_i), best_i);
+		for (size_t lane{ 0 }; lane < 8; ++lane)
+		{
+			const size_t lane_index = static_cast<size_t>(lane_i[lane]);
+			if (lane_t[lane] < inter_time_ || (lane_t[lane] == inter_time_ && lane_t[lane] < FLT_MAX && lane_index < index_))
+			{ inter_time_ = lane_t[lane]; index_ = lane_index; }
+		}
+		CircleRayNearestScalar(pt_, unit_, inv_length_, circles_, i, n_, inter_time_, index_);
+	}
+
+	// same as CirclePointSweepSSE(), 8 points at a time
+	SIMD_TARGET_AVX2 void CirclePointSweepAVX2(uint8_t* hits_, float* inter_time_, const Circle& circle_, const Vec2 vel_,
+		const Vec2Stream& points_, const Vec2Stream& vels_, const size_t n_)
+	{
+		const __m256 zero = _mm256_setzero_ps(), one = _mm256_set1_ps(1);
+		const __m256 cx = _mm256_set1_ps(circle_.center.x), cy = _mm256_set1_ps(circle_.center.y);
+		const __m256 radius_sq = _mm256_set1_ps(circle_.radius * circle_.radius);
+		const __m256 cvx = _mm256_set1_ps(vel_.x), cvy = _mm256_set1_ps(vel_.y);
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const __m256 mx = _mm256_sub_ps(_mm256_load_ps(points_.x + i), cx), my = _mm256_sub_ps(_mm256_load_ps(points_.y + i), cy);
+			const __m256 vx = _mm256_sub_ps(_mm256_load_ps(vels_.x + i), cvx), vy = _mm256_sub_ps(_mm256_load_ps(vels_.y + i), cvy);
+			const __m256 a = _mm256_fmadd_ps(vx, vx, _mm256_mul_ps(vy, vy));
+			const __m256 b = _mm256_fmadd_ps(mx, vx, _mm256_mul_ps(my, vy));
+			const __m256 c = _mm256_sub_ps(_mm256_fmadd_ps(mx, mx, _mm256_mul_ps(my, my)), radius_sq);
+			const __m256 disc = _mm256_fmsub_ps(b, b, _mm256_mul_ps(a, c));
+			const __m256 inside = _mm256_cmp_ps(c, zero, _CMP_LT_OQ);
+			const __m256 t = _mm256_div_ps(_mm256_sub_ps(_mm256_sub_ps(zero, b), _mm256_sqrt_ps(_mm256_max_ps(disc, zero))), a);
+			_mm256_storeu_ps(inter_time_ + i, _mm256_andnot_ps(inside, t));
+			const __m256 ahead = _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(b, zero, _CMP_LT_OQ), _mm256_cmp_ps(disc, zero, _CMP_GE_OQ)),
+				_mm256_cmp_ps(t, one, _CMP_LE_OQ));
+			hits_[i / 8] = static_cast<uint8_t>(_mm256_movemask_ps(_mm256_or_ps(inside, ahead)));
+		}
+		CirclePointSweepScalar(hits_, inter_time_, circle_, vel_, points_, vels_, i, n_);
+	}
+
+	// SafeInverse() on 8 lanes
+	SIMD_TARGET_AVX2 __m256 SafeInverseAVX2(const __m256 vel_)
+	{
+		const __m256 sign = _mm256_set1_ps(-0.0f), tiny = _mm256_set1_ps(SLAB_TINY);
+		const __m256 small = _mm256_cmp_ps(_mm256_andnot_ps(sign, vel_), tiny, _CMP_LT_OQ);
+		return _mm256_div_ps(_mm256_set1_ps(1), _mm256_blendv_ps(vel_, _mm256_or_ps(tiny, _mm256_and_ps(sign, vel_)), small));
+	}
+
+	// same as AABBPointSweepSSE(), 8 points at a time
+	SIMD_TARGET_AVX2 void AABBPointSweepAVX2(uint8_t* hits_, float* inter_time_, const AABB& aabb_, const Vec2 vel_,
+		const Vec2Stream& points_, const Vec2Stream& vels_, const size_t n_)
+	{
+		const __m256 min_x = _mm256_set1_ps(aabb_.min.x), min_y = _mm256_set1_ps(aabb_.min.y);
+		const __m256 max_x = _mm256_set1_ps(aabb_.max.x), max_y = _mm256_set1_ps(aabb_.max.y);
+		const __m256 bvx = _mm256_set1_ps(vel_.x), bvy = _mm256_set1_ps(vel_.y);
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const __m256 px = _mm256_load_ps(points_.x + i), py = _mm256_load_ps(points_.y + i);
+			const __m256 inv_x = SafeInverseAVX2(_mm256_sub_ps(_mm256_load_ps(vels_.x + i), bvx));
+			const __m256 inv_y = SafeInverseAVX2(_mm256_sub_ps(_mm256_load_ps(vels_.y + i), bvy));
+			const __m256 tx0 = _mm256_mul_ps(_mm256_sub_ps(min_x, px), inv_x), tx1 = _mm256_mul_ps(_mm256_sub_ps(max_x, px), inv_x);
+			const __m256 ty0 = _mm256_mul_ps(_mm256_sub_ps(min_y, py), inv_y), ty1 = _mm256_mul_ps(_mm256_sub_ps(max_y, py), inv_y);
+			const __m256 enter = _mm256_max_ps(_mm256_max_ps(_mm256_min_ps(tx0, tx1), _mm256_min_ps(ty0, ty1)), _mm256_setzero_ps());
+			const __m256 exit = _mm256_min_ps(_mm256_min_ps(_mm256_max_ps(tx0, tx1), _mm256_max_ps(ty0, ty1)), _mm256_set1_ps(1));
+			_mm256_storeu_ps(inter_time_ + i, enter);
+			hits_[i / 8] = static_cast<uint8_t>(_mm256_movemask_ps(_mm256_cmp_ps(enter, exit, _CMP_LE_OQ)));
+		}
+		AABBPointSweepScalar(hits_, inter_time_, aabb_, vel_, points_, vels_, i, n_);
+	}
+
+	// same as AxisSweepSSE(), 8 boxes at a time
+	SIMD_TARGET_AVX2 void AxisSweepAVX2(const __m256 min_, const __m256 max_, const __m256 (&s_)[5], __m256& enter_, __m256& exit_)
+	{
+		const __m256 t0 = _mm256_mul_ps(_mm256_sub_ps(min_, s_[2]), s_[0]), t1 = _mm256_mul_ps(_mm256_sub_ps(max_, s_[1]), s_[0]);
+		const __m256 overlap = _mm256_and_ps(_mm256_cmp_ps(min_, s_[2], _CMP_LT_OQ), _mm256_cmp_ps(s_[1], max_, _CMP_LT_OQ));
+		const __m256 still_enter = _mm256_blendv_ps(_mm256_set1_ps(FLT_MAX), _mm256_set1_ps(-FLT_MAX), overlap);
+		enter_ = _mm256_blendv_ps(_mm256_min_ps(t0, t1), still_enter, s_[3]);
+		exit_ = _mm256_blendv_ps(_mm256_max_ps(t0, t1), _mm256_xor_ps(still_enter, _mm256_set1_ps(-0.0f)), s_[3]);
+	}
+
+	// same as AABBSweepSSE(), one byte of hits_ per iteration
+	SIMD_TARGET_AVX2 void AABBSweepAVX2(uint8_t* hits_, float* inter_time_, float* normal_x_, float* normal_y_, const AABB& aabb_,
+		const Vec2 vel_, const AABBStream& boxes_, const size_t n_)
+	{
+		const Vec2 inv_vel(SafeInverse(vel_.x), SafeInverse(vel_.y));
+		const __m256 x[5]{ _mm256_set1_ps(inv_vel.x), _mm256_set1_ps(aabb_.min.x), _mm256_set1_ps(aabb_.max.x),
+			_mm256_castsi256_ps(_mm256_set1_epi32(fabsf(vel_.x) < SLAB_TINY ? -1 : 0)), _mm256_set1_ps(vel_.x > 0 ? -1.0f : 1.0f) };
+		const __m256 y[5]{ _mm256_set1_ps(inv_vel.y), _mm256_set1_ps(aabb_.min.y), _mm256_set1_ps(aabb_.max.y),
+			_mm256_castsi256_ps(_mm256_set1_epi32(fabsf(vel_.y) < SLAB_TINY ? -1 : 0)), _mm256_set1_ps(vel_.y > 0 ? -1.0f : 1.0f) };
+		const __m256 zero = _mm256_setzero_ps(), one = _mm256_set1_ps(1);
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			__m256 enter_x, exit_x, enter_y, exit_y;
+			AxisSweepAVX2(_mm256_load_ps(boxes_.min_x + i), _mm256_load_ps(boxes_.max_x + i), x, enter_x, exit_x);
+			AxisSweepAVX2(_mm256_load_ps(boxes_.min_y + i), _mm256_load_ps(boxes_.max_y + i), y, enter_y, exit_y);
+			const __m256 enter = _mm256_max_ps(enter_x, enter_y), exit = _mm256_min_ps(exit_x, exit_y);
+			const __m256 entering = _mm256_cmp_ps(enter, zero, _CMP_GE_OQ), along_x = _mm256_cmp_ps(enter_x, enter_y, _CMP_GE_OQ);
+			_mm256_storeu_ps(inter_time_ + i, _mm256_max_ps(enter, zero));
+			_mm256_storeu_ps(normal_x_ + i, _mm256_and_ps(_mm256_and_ps(entering, along_x), x[4]));
+			_mm256_storeu_ps(normal_y_ + i, _mm256_and_ps(_mm256_andnot_ps(along_x, entering), y[4]));
+			const __m256 hit = _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(enter, exit, _CMP_LT_OQ), _mm256_cmp_ps(enter, one, _CMP_LT_OQ)),
+				_mm256_cmp_ps(exit, zero, _CMP_GT_OQ));
+			hits_[i / 8] = static_cast<uint8_t>(_mm256_movemask_ps(hit));
+		}
+		AABBSweepScalar(hits_, inter_time_, normal_x_, normal_y_, aabb_, vel_, boxes_, i, n_);
+	}
+
+	// c_ holds the center and the radius, touching does not count
+	SIMD_TARGET_AVX2 __m256 CircleCircleAVX2(const __m256 (&c_)[3], const __m256 x_, const __m256 y_, const __m256 radius_)
+	{
+		const __m256 dx = _mm256_sub_ps(x_, c_[0]), dy = _mm256_sub_ps(y_, c_[1]);
+		const __m256 sum = _mm256_add_ps(radius_, c_[2]);
+		return _mm256_cmp_ps(_mm256_mul_ps(sum, sum), _mm256_fmadd_ps(dx, dx, _mm256_mul_ps(dy, dy)), _CMP_GT_OQ);
+	}
+
+	//
+	SIMD_TARGET_AVX2 int CircleCircleAVX2(const __m256 (&c_)[3], const CircleStream& circles_, const size_t i_)
+	{
+		return _mm256_movemask_ps(CircleCircleAVX2(c_, _mm256_load_ps(circles_.center_x + i_),
+			_mm256_load_ps(circles_.center_y + i_), _mm256_load_ps(circles_.radius + i_)));
+	}
+
+	//
+	SIMD_TARGET_AVX2 void CircleCircleAVX2(uint8_t* hits_, const Circle& circle_, const CircleStream& circles_, const size_t n_)
+	{
+		const __m256 c[3]{ _mm256_set1_ps(circle_.center.x), _mm256_set1_ps(circle_.center.y), _mm256_set1_ps(circle_.radius) };
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{ hits_[i / 8] = static_cast<uint8_t>(CircleCircleAVX2(c, circles_, i)); }
+		CircleCircleScalar(hits_, circle_, circles_, i, n_);
+	}
+
+	//
+	SIMD_TARGET_AVX2 size_t CircleCircleAVX2(size_t* hits_, const Circle& circle_, const CircleStream& circles_, const size_t n_)
+	{
+		const __m256 c[3]{ _mm256_set1_ps(circle_.center.x), _mm256_set1_ps(circle_.center.y), _mm256_set1_ps(circle_.radius) };
+		size_t count{ 0 }, i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			int mask = CircleCircleAVX2(c, circles_, i);
+			for (size_t j{ 0 }; mask; ++j, mask >>= 1)
+			{
+				hits_[count] = i + j;
+				count += mask & 1;
+			}
+		}
+		return CircleCircleScalar(hits_, count, circle_, circles_, i, n_);
+	}
+
+	// same as CircleCirclePairsSSE() with blocks of 8 columns
+	SIMD_TARGET_AVX2 size_t CircleCirclePairsAVX2(size_t* pairs_, const CircleStream& circles_, const size_t n_)
+	{
+		constexpr size_t TILE = 4;
+		size_t count{ 0 }, i{ 0 };
+		for (; i + TILE <= n_; i += TILE)
+		{
+			__m256 rows[TILE][3];
+			for (size_t t{ 0 }; t < TILE; ++t)
+			{
+				rows[t][0] = _mm256_set1_ps(circles_.center_x[i + t]);
+				rows[t][1] = _mm256_set1_ps(circles_.center_y[i + t]);
+				rows[t][2] = _mm256_set1_ps(circles_.radius[i + t]);
+			}
+			for (size_t j{ (i + 1) / 8 * 8 }; j < n_; j += 8)
+			{
+				const __m256 x = _mm256_load_ps(circles_.center_x + j), y = _mm256_load_ps(circles_.center_y + j);
+				const __m256 radius = _mm256_load_ps(circles_.radius + j);
+				for (size_t t{ 0 }; t < TILE; ++t)
+				{
+					const int mask = _mm256_movemask_ps(CircleCircleAVX2(rows[t], x, y, radius)) & PairLanes(i + t, j, n_, 8);
+					count = EmitPairs(pairs_, count, i + t, j, mask);
+				}
+			}
+		}
+		return CircleCirclePairsScalar(pairs_, count, circles_, i, n_);
+	}
+
+	// same as OBBOBBSSE(), 8 boxes at a time
+	SIMD_TARGET_AVX2 void OBBOBBAVX2(uint8_t* hits_, const OBB2D& obb_, const OBB2DStream& boxes_, const size_t n_)
+	{
+		const __m256 sign = _mm256_set1_ps(-0.0f);
+		const __m256 acx = _mm256_set1_ps(obb_.center.x), acy = _mm256_set1_ps(obb_.center.y);
+		const __m256 hax = _mm256_set1_ps(obb_.half_ext.x), hay = _mm256_set1_ps(obb_.half_ext.y);
+		const __m256 ca = _mm256_set1_ps(obb_.rot.c), sa = _mm256_set1_ps(obb_.rot.s);
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const __m256 cb = _mm256_load_ps(boxes_.rot_c + i), sb = _mm256_load_ps(boxes_.rot_s + i);
+			const __m256 hbx = _mm256_load_ps(boxes_.half_x + i), hby = _mm256_load_ps(boxes_.half_y + i);
+			const __m256 dx = _mm256_sub_ps(_mm256_load_ps(boxes_.center_x + i), acx);
+			const __m256 dy = _mm256_sub_ps(_mm256_load_ps(boxes_.center_y + i), acy);
+			const __m256 cr = _mm256_andnot_ps(sign, _mm256_fmadd_ps(ca, cb, _mm256_mul_ps(sa, sb)));
+			const __m256 sr = _mm256_andnot_ps(sign, _mm256_fmsub_ps(sa, cb, _mm256_mul_ps(ca, sb)));
+
+			const __m256 du0 = _mm256_andnot_ps(sign, _mm256_fmadd_ps(dx, ca, _mm256_mul_ps(dy, sa)));
+			const __m256 du1 = _mm256_andnot_ps(sign, _mm256_fmsub_ps(dy, ca, _mm256_mul_ps(dx, sa)));
+			const __m256 dv0 = _mm256_andnot_ps(sign, _mm256_fmadd_ps(dx, cb, _mm256_mul_ps(dy, sb)));
+			const __m256 dv1 = _mm256_andnot_ps(sign, _mm256_fmsub_ps(dy, cb, _mm256_mul_ps(dx, sb)));
+
+			const __m256 r0 = _mm256_add_ps(hax, _mm256_fmadd_ps(hbx, cr, _mm256_mul_ps(hby, sr)));
+			const __m256 r1 = _mm256_add_ps(hay, _mm256_fmadd_ps(hbx, sr, _mm256_mul_ps(hby, cr)));
+			const __m256 r2 = _mm256_add_ps(hbx, _mm256_fmadd_ps(hax, cr, _mm256_mul_ps(hay, sr)));
+			const __m256 r3 = _mm256_add_ps(hby, _mm256_fmadd_ps(hax, sr, _mm256_mul_ps(hay, cr)));
+			const __m256 hit = _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(du0, r0, _CMP_LT_OQ), _mm256_cmp_ps(du1, r1, _CMP_LT_OQ)),
+				_mm256_and_ps(_mm256_cmp_ps(dv0, r2, _CMP_LT_OQ), _mm256_cmp_ps(dv1, r3, _CMP_LT_OQ)));
+			hits_[i / 8] = static_cast<uint8_t>(_mm256_movemask_ps(hit));
+		}
+		OBBOBBScalar(hits_, obb_, boxes_, i, n_);
+	}
+	#endif
+}
 
 //
 bool CDStatic_CirclePoint(const Circle circle_, const Pt2 point_)
@@ -11,26 +1605,31 @@ bool CDStatic_CirclePoint(const Circle circle_, const Pt2 point_)
 
 //
 bool CDStatic_RectPoint(const Rect rect_, const Pt2 point_)
+{ return CDStatic_RectPoint(AABB(rect_), point_); }
+
+//
+bool CDStatic_RectPoint(const AABB aabb_, const Pt2 point_)
 {
-	AABB aabb(rect_);
-	return aabb.min.x <= point_.x && point_.x <= aabb.max.x &&
-		aabb.min.y <= point_.y && point_.y <= aabb.max.y;
+	return aabb_.min.x <= point_.x && point_.x <= aabb_.max.x &&
+		aabb_.min.y <= point_.y && point_.y <= aabb_.max.y;
 }
 
 //
 bool CDStatic_CircleCircle(const Circle circle_0_, const Circle circle_1_)
 {
-	const float combined_radius_sq = (circle_0_.radius + circle_1_.radius) * (circle_0_.radius + circle_1_.radius);
-	const float dist_sq = Vector2DDotProduct(circle_0_.center - circle_1_.center, circle_0_.center - circle_1_.center);
-	return combined_radius_sq > dist_sq;
+	const float combined_radius = circle_0_.radius + circle_1_.radius;
+	return combined_radius * combined_radius > (circle_0_.center - circle_1_.center).LengthSq();
 }
 
 //
 bool CDStatic_RectRect_AABB(const Rect rect_0_, const Rect rect_1_)
+{ return CDStatic_RectRect_AABB(AABB(rect_0_), AABB(rect_1_)); }
+
+//
+bool CDStatic_RectRect_AABB(const AABB aabb_0_, const AABB aabb_1_)
 {
-	AABB aabb_0(rect_0_); AABB aabb_1(rect_1_);
-	if (aabb_0.min.x >= aabb_1.max.x || aabb_1.min.x >= aabb_0.max.x ||
-		aabb_0.min.y >= aabb_1.max.y || aabb_1.min.y >= aabb_0.max.y)
+	if (aabb_0_.min.x >= aabb_1_.max.x || aabb_1_.min.x >= aabb_0_.max.x ||
+		aabb_0_.min.y >= aabb_1_.max.y || aabb_1_.min.y >= aabb_0_.max.y)
 	{
 		return false;
 	}
@@ -40,25 +1639,19 @@ bool CDStatic_RectRect_AABB(const Rect rect_0_, const Rect rect_1_)
 	}
 }
 
-// SUSUSUSUSUSUSUSUS
+//
 bool CDStatic_CircleRect(const Circle circle_, const Rect rect_)
-{
-	AABB aabb(rect_);
-	Pt2 test = circle_.center;
-
-	if (circle_.center.x < aabb.min.x)
-		test.x = aabb.min.x;
-	else if (circle_.center.x > aabb.max.x)
-		test.x = aabb.max.x;
+{ return CDStatic_CircleRect(circle_, AABB(rect_)); }
 
-	if (circle_.center.y < aabb.min.y)
-		test.y = aabb.min.y;
-	else if (circle_.center.y > aabb.max.y)
-		test.y = aabb.max.y;
+// distance to the clamped center, no branches
+bool CDStatic_CircleRect(const Circle circle_, const AABB aabb_)
+{ return PointAABBDistSq(circle_.center, aabb_) <= circle_.radius * circle_.radius; }
 
-	if (Vector2DDotProduct(circle_.center - test, circle_.center - test) <= circle_.radius * circle_.radius)
-		return true;
-	return false;
+//
+bool CDStatic_CircleRect(const Circle circle_, const AABB aabb_, Pt2& closest_, float& depth_)
+{
+	return CircleAABBContact(circle_.center.x, circle_.center.y, circle_.radius, aabb_.min.x, aabb_.min.y, aabb_.max.x,
+		aabb_.max.y, closest_.x, closest_.y, depth_);
 }
 
 //
@@ -88,17 +1681,488 @@ bool CDStatic_CircleRay(const Circle circle_, const Ray ray_, float& inter_time_
 }
 
 //
-bool CDDynamic_CirclePoint(const Circle circle_, const Vec2 circle_vel_, const Pt2 point_, const Vec2 point_vel_)
+void CDStatic_CircleRayBatch(uint8_t* hits_, float* inter_time_, const Ray ray_, const CircleStream& circles_)
+{
+	const float length = ray_.dir.Length();
+	if (length <= VEC2_EPSILON)
+	{ throw "Division by 0 in CDStatic_CircleRayBatch()"; }
+	const float inv_length = 1.0f / length;
+	const Vec2 unit = ray_.dir * inv_length;
+	const size_t n = circles_.Size();
+	switch (SIMDGetLevel())
+	{
+	#if SIMD_X86
+	case SIMDLevel::AVX2: CircleRayAVX2(hits_, inter_time_, ray_.pt, unit, inv_length, circles_, n); break;
+	case SIMDLevel::SSE: CircleRaySSE(hits_, inter_time_, ray_.pt, unit, inv_length, circles_, n); break;
+	#endif
+	default: CircleRayScalar(hits_, inter_time_, ray_.pt, unit, inv_length, circles_, 0, n); break;
+	}
+}
+
+//
+bool CDStatic_CircleRayNearest(const Ray ray_, const CircleStream& circles_, float& inter_time_, size_t& index_)
+{
+	const float length = ray_.dir.Length();
+	if (length <= VEC2_EPSILON)
+	{ throw "Division by 0 in CDStatic_CircleRayNearest()"; }
+	const float inv_length = 1.0f / length;
+	const Vec2 unit = ray_.dir * inv_length;
+	const size_t n = circles_.Size();
+	// no hit leaves the time above 1
+	float t{ FLT_MAX };
+	size_t index{ 0 };
+	switch (SIMDGetLevel())
+	{
+	#if SIMD_X86
+	case SIMDLevel::AVX2: CircleRayNearestAVX2(ray_.pt, unit, inv_length, circles_, n, t, index); break;
+	case SIMDLevel::SSE: CircleRayNearestSSE(ray_.pt, unit, inv_length, circles_, n, t, index); break;
+	#endif
+	default: CircleRayNearestScalar(ray_.pt, unit, inv_length, circles_, 0, n, t, index); break;
+	}
+	if (t > 1)
+	{ return false; }
+	inter_time_ = t;
+	index_ = index;
+	return true;
+}
+
+//
+bool CDStatic_CircleLineSegment(const Circle circle_, const LineSegment segment_)
+{
+	const Vec2 diff = circle_.center - ClosestPointOnSegment(segment_.pt0, segment_.pt1, circle_.center);
+	return Vector2DDotProduct(diff, diff) <= circle_.radius * circle_.radius;
+}
+
+//
+bool CDStatic_OBBPoint(const OBB2D obb_, const Pt2 point_)
+{
+	const Vec2 local = Rot2InverseRotate(obb_.rot, point_ - obb_.center);
+	return fabsf(local.x) <= obb_.half_ext.x && fabsf(local.y) <= obb_.half_ext.y;
+}
+
+//
+bool CDStatic_CircleOBB(const Circle circle_, const OBB2D obb_)
+{ return CircleOBB(circle_, obb_, nullptr); }
+
+//
+bool CDStatic_CircleOBB(const Circle circle_, const OBB2D obb_, Vec2& mtv_)
+{ return CircleOBB(circle_, obb_, &mtv_); }
+
+//
+bool CDStatic_OBBOBB(const OBB2D obb_0_, const OBB2D obb_1_)
+{ return OBBOBB(obb_0_, obb_1_, nullptr); }
+
+//
+bool CDStatic_OBBOBB(const OBB2D obb_0_, const OBB2D obb_1_, Vec2& mtv_)
+{ return OBBOBB(obb_0_, obb_1_, &mtv_); }
+
+//
+bool CDStatic_OBBAABB(const OBB2D obb_, const AABB aabb_)
+{ return OBBOBB(obb_, OBB2D(aabb_), nullptr); }
+
+//
+bool CDStatic_OBBAABB(const OBB2D obb_, const AABB aabb_, Vec2& mtv_)
+{ return OBBOBB(obb_, OBB2D(aabb_), &mtv_); }
+
+//
+bool CDStatic_CircleCapsule(const Circle circle_, const Capsule2D capsule_)
+{
+	const float radius = circle_.radius + capsule_.radius;
+	const Vec2 diff = circle_.center - ClosestPointOnSegment(capsule_.pt0, capsule_.pt1, circle_.center);
+	return Vector2DDotProduct(diff, diff) <= radius * radius;
+}
+
+//
+bool CDStatic_CapsuleCapsule(const Capsule2D capsule_0_, const Capsule2D capsule_1_)
+{
+	Pt2 closest_0, closest_1;
+	return CDStatic_CapsuleCapsule(capsule_0_, capsule_1_, closest_0, closest_1);
+}
+
+//
+bool CDStatic_CapsuleCapsule(const Capsule2D capsule_0_, const Capsule2D capsule_1_, Pt2& closest_0_, Pt2& closest_1_)
+{
+	const float radius = capsule_0_.radius + capsule_1_.radius;
+	return SegmentSegment(capsule_0_.pt0, capsule_0_.pt1, capsule_1_.pt0, capsule_1_.pt1, closest_0_, closest_1_) <= radius * radius;
+}
+
+//
+bool CDStatic_CapsuleLineSegment(const Capsule2D capsule_, const LineSegment segment_)
+{
+	Pt2 closest_0, closest_1;
+	return SegmentSegment(capsule_.pt0, capsule_.pt1, segment_.pt0, segment_.pt1, closest_0, closest_1) <= capsule_.radius * capsule_.radius;
+}
+
+//
+bool CDStatic_CapsuleAABB(const Capsule2D capsule_, const AABB aabb_)
 {
+	if (SegmentCrossesAABB(capsule_.pt0, capsule_.pt1, aabb_))
+	{ return true; }
+
+	// otherwise the closest pair of a segment and a convex box always has a
+	// segment end or a box corner in it
+	const float radius_sq = capsule_.radius * capsule_.radius;
+	if (PointAABBDistSq(capsule_.pt0, aabb_) <= radius_sq || PointAABBDistSq(capsule_.pt1, aabb_) <= radius_sq)
+	{ return true; }
+	const Pt2 corners[4]{ aabb_.min, { aabb_.max.x, aabb_.min.y }, aabb_.max, { aabb_.min.x, aabb_.max.y } };
+	for (const Pt2& corner : corners)
+	{
+		if ((corner - ClosestPointOnSegment(capsule_.pt0, capsule_.pt1, corner)).LengthSq() <= radius_sq)
+		{ return true; }
+	}
 	return false;
 }
 
 //
-bool CDDynamic_RectPoint(const Rect rect_, const Vec2 rect_vel_, const Pt2 point_, const Vec2 point_vel_)
+bool CDStatic_PolygonPolygon(const ConvexPolygon2D& polygon_0_, const ConvexPolygon2D& polygon_1_)
+{
+	size_t axis_cache{ 0 };
+	return CDStatic_PolygonPolygon(polygon_0_, polygon_1_, axis_cache);
+}
+
+//
+bool CDStatic_PolygonPolygon(const ConvexPolygon2D& polygon_0_, const ConvexPolygon2D& polygon_1_, size_t& axis_cache_)
+{
+	const size_t count_0 = polygon_0_.count, count = count_0 + polygon_1_.count;
+	const auto separation = [&](const size_t axis_)
+	{
+		return axis_ < count_0 ?
+			EdgeSeparation(polygon_0_, axis_, polygon_1_) :
+			EdgeSeparation(polygon_1_, axis_ - count_0, polygon_0_);
+	};
+
+	// coherent pairs usually stay separated along last frame's axis
+	if (axis_cache_ < count && separation(axis_cache_) >= 0)
+	{ return false; }
+	for (size_t axis{ 0 }; axis < count; ++axis)
+	{
+		if (axis != axis_cache_ && separation(axis) >= 0)
+		{
+			axis_cache_ = axis;
+			return false;
+		}
+	}
+	return true;
+}
+
+//
+bool CDStatic_CirclePolygon(const Circle circle_, const ConvexPolygon2D& polygon_)
 {
+	// inside every edge means the center is inside, otherwise the nearest edge decides
+	const float radius_sq = circle_.radius * circle_.radius;
+	bool inside{ true };
+	for (size_t i{ 0 }; i < polygon_.count; ++i)
+	{
+		if (Vector2DDotProduct(polygon_.normals[i], circle_.center - polygon_.vertices[i]) <= 0)
+		{ continue; }
+		inside = false;
+		const Pt2 closest = ClosestPointOnSegment(polygon_.vertices[i], polygon_.vertices[(i + 1) % polygon_.count], circle_.center);
+		if ((circle_.center - closest).LengthSq() <= radius_sq)
+		{ return true; }
+	}
+	return inside;
+}
+
+//
+bool CDStatic_CapsulePolygon(const Capsule2D capsule_, const ConvexPolygon2D& polygon_)
+{
+	if (CDStatic_CirclePolygon(Circle{ capsule_.pt0, capsule_.radius }, polygon_))
+	{ return true; }
+
+	// crossing an edge comes out at distance 0
+	const float radius_sq = capsule_.radius * capsule_.radius;
+	Pt2 closest_0, closest_1;
+	for (size_t i{ 0 }; i < polygon_.count; ++i)
+	{
+		if (SegmentSegment(capsule_.pt0, capsule_.pt1, polygon_.vertices[i], polygon_.vertices[(i + 1) % polygon_.count],
+			closest_0, closest_1) <= radius_sq)
+		{ return true; }
+	}
 	return false;
 }
 
+//
+float CDStatic_PolygonDistance(const ConvexPolygon2D& polygon_0_, const ConvexPolygon2D& polygon_1_,
+	Pt2& closest_0_, Pt2& closest_1_)
+{
+	SimplexVertex simplex[3];
+	size_t count{ 0 };
+	return GJK(polygon_0_, polygon_1_, simplex, count, closest_0_, closest_1_);
+}
+
+//
+bool CDStatic_PolygonPenetration(const ConvexPolygon2D& polygon_0_, const ConvexPolygon2D& polygon_1_, Vec2& mtv_)
+{
+	SimplexVertex simplex[3];
+	size_t count{ 0 };
+	Pt2 closest_0, closest_1;
+	if (GJK(polygon_0_, polygon_1_, simplex, count, closest_0, closest_1) > 0)
+	{ return false; }
+	return EPA(polygon_0_, polygon_1_, simplex, count, mtv_);
+}
+
+//
+size_t CDStatic_CircleLineSegmentBatch(size_t* hits_, const Circle circle_, const LineSegmentStream& segments_)
+{
+	const size_t n = segments_.Size();
+	switch (SIMDGetLevel())
+	{
+	#if SIMD_X86
+	case SIMDLevel::AVX2: return CircleLineSegmentAVX2(hits_, circle_, segments_, n);
+	case SIMDLevel::SSE: return CircleLineSegmentSSE(hits_, circle_, segments_, n);
+	#endif
+	default: return CircleLineSegmentScalar(hits_, 0, circle_, segments_, 0, n);
+	}
+}
+
+//
+void CDStatic_RectRect_AABBBatch(uint8_t* hits_, const AABB aabb_, const AABBStream& boxes_)
+{
+	const size_t n = boxes_.Size();
+	switch (SIMDGetLevel())
+	{
+	#if SIMD_X86
+	case SIMDLevel::AVX2: AABBAABBAVX2(hits_, aabb_, boxes_, n); break;
+	case SIMDLevel::SSE: AABBAABBSSE(hits_, aabb_, boxes_, n); break;
+	#endif
+	default: AABBAABBScalar(hits_, aabb_, boxes_, 0, n); break;
+	}
+}
+
+//
+void CDStatic_CircleRectBatch(uint8_t* hits_, const Circle circle_, const AABBStream& boxes_)
+{
+	const size_t n = boxes_.Size();
+	switch (SIMDGetLevel())
+	{
+	#if SIMD_X86
+	case SIMDLevel::AVX2: CircleAABBAVX2(hits_, circle_, boxes_, n); break;
+	case SIMDLevel::SSE: CircleAABBSSE(hits_, circle_, boxes_, n); break;
+	#endif
+	default: CircleAABBScalar(hits_, circle_, boxes_, 0, n); break;
+	}
+}
+
+//
+void CDStatic_CircleRectBatch(uint8_t* hits_, const CircleStream& circles_, const AABB aabb_)
+{
+	const size_t n = circles_.Size();
+	switch (SIMDGetLevel())
+	{
+	#if SIMD_X86
+	case SIMDLevel::AVX2: CirclesAABBAVX2(hits_, circles_, aabb_, n); break;
+	case SIMDLevel::SSE: CirclesAABBSSE(hits_, circles_, aabb_, n); break;
+	#endif
+	default: CirclesAABBScalar(hits_, circles_, aabb_, 0, n); break;
+	}
+}
+
+//
+void CDStatic_CircleRectBatch(uint8_t* hits_, float* closest_x_, float* closest_y_, float* depth_, const Circle circle_,
+	const AABBStream& boxes_)
+{
+	const size_t n = boxes_.Size();
+	switch (SIMDGetLevel())
+	{
+	#if SIMD_X86
+	case SIMDLevel::AVX2: CircleAABBContactAVX2(hits_, { closest_x_, closest_y_, depth_ }, circle_, boxes_, n); break;
+	case SIMDLevel::SSE: CircleAABBContactSSE(hits_, { closest_x_, closest_y_, depth_ }, circle_, boxes_, n); break;
+	#endif
+	default: CircleAABBContactScalar(hits_, closest_x_, closest_y_, depth_, circle_, boxes_, 0, n); break;
+	}
+}
+
+//
+void CDStatic_CircleRectBatch(uint8_t* hits_, float* closest_x_, float* closest_y_, float* depth_,
+	const CircleStream& circles_, const AABB aabb_)
+{
+	const size_t n = circles_.Size();
+	switch (SIMDGetLevel())
+	{
+	#if SIMD_X86
+	case SIMDLevel::AVX2: CirclesAABBContactAVX2(hits_, { closest_x_, closest_y_, depth_ }, circles_, aabb_, n); break;
+	case SIMDLevel::SSE: CirclesAABBContactSSE(hits_, { closest_x_, closest_y_, depth_ }, circles_, aabb_, n); break;
+	#endif
+	default: CirclesAABBContactScalar(hits_, closest_x_, closest_y_, depth_, circles_, aabb_, 0, n); break;
+	}
+}
+
+//
+void CDStatic_CircleCircleBatch(uint8_t* hits_, const Circle circle_, const CircleStream& circles_)
+{
+	const size_t n = circles_.Size();
+	switch (SIMDGetLevel())
+	{
+	#if SIMD_X86
+	case SIMDLevel::AVX2: CircleCircleAVX2(hits_, circle_, circles_, n); break;
+	case SIMDLevel::SSE: CircleCircleSSE(hits_, circle_, circles_, n); break;
+	#endif
+	default: CircleCircleScalar(hits_, circle_, circles_, 0, n); break;
+	}
+}
+
+//
+size_t CDStatic_CircleCircleBatch(size_t* hits_, const Circle circle_, const CircleStream& circles_)
+{
+	const size_t n = circles_.Size();
+	switch (SIMDGetLevel())
+	{
+	#if SIMD_X86
+	case SIMDLevel::AVX2: return CircleCircleAVX2(hits_, circle_, circles_, n);
+	case SIMDLevel::SSE: return CircleCircleSSE(hits_, circle_, circles_, n);
+	#endif
+	default: return CircleCircleScalar(hits_, 0, circle_, circles_, 0, n);
+	}
+}
+
+//
+size_t CDStatic_CircleCircleAllPairs(size_t* pairs_, const CircleStream& circles_)
+{
+	const size_t n = circles_.Size();
+	switch (SIMDGetLevel())
+	{
+	#if SIMD_X86
+	case SIMDLevel::AVX2: return CircleCirclePairsAVX2(pairs_, circles_, n);
+	case SIMDLevel::SSE: return CircleCirclePairsSSE(pairs_, circles_, n);
+	#endif
+	default: return CircleCirclePairsScalar(pairs_, 0, circles_, 0, n);
+	}
+}
+
+//
+void CDStatic_PolygonPolygonBatch(uint8_t* hits_, const ConvexPolygon2D& polygon_, const ConvexPolygon2D* polygons_,
+	const size_t count_, size_t* axis_cache_)
+{
+	for (size_t i{ 0 }; i < count_; ++i)
+	{
+		size_t axis_cache{ 0 };
+		const bool hit = CDStatic_PolygonPolygon(polygon_, polygons_[i], axis_cache_ ? axis_cache_[i] : axis_cache);
+		if (i % 8 == 0)
+		{ hits_[i / 8] = 0; }
+		hits_[i / 8] |= static_cast<uint8_t>(hit << (i % 8));
+	}
+}
+
+//
+void CDStatic_PolygonDistanceBatch(float* distance_, const ConvexPolygon2D& polygon_, const ConvexPolygon2D* polygons_,
+	const size_t count_)
+{
+	Pt2 closest_0, closest_1;
+	for (size_t i{ 0 }; i < count_; ++i)
+	{ distance_[i] = CDStatic_PolygonDistance(polygon_, polygons_[i], closest_0, closest_1); }
+}
+
+//
+void CDStatic_PolygonPenetrationBatch(uint8_t* hits_, Vec2* mtv_, const ConvexPolygon2D& polygon_,
+	const ConvexPolygon2D* polygons_, const size_t count_)
+{
+	for (size_t i{ 0 }; i < count_; ++i)
+	{
+		mtv_[i] = { 0, 0 };
+		const bool hit = CDStatic_PolygonPenetration(polygon_, polygons_[i], mtv_[i]);
+		if (i % 8 == 0)
+		{ hits_[i / 8] = 0; }
+		hits_[i / 8] |= static_cast<uint8_t>(hit << (i % 8));
+	}
+}
+
+//
+void CDStatic_OBBOBBBatch(uint8_t* hits_, const OBB2D obb_, const OBB2DStream& boxes_)
+{
+	const size_t n = boxes_.Size();
+	switch (SIMDGetLevel())
+	{
+	#if SIMD_X86
+	case SIMDLevel::AVX2: OBBOBBAVX2(hits_, obb_, boxes_, n); break;
+	case SIMDLevel::SSE: OBBOBBSSE(hits_, obb_, boxes_, n); break;
+	#endif
+	default: OBBOBBScalar(hits_, obb_, boxes_, 0, n); break;
+	}
+}
+
+//
+bool CDDynamic_CirclePoint(const Circle circle_, const Vec2 circle_vel_, const Pt2 point_, const Vec2 point_vel_,
+	Pt2& inter_pt_, float& inter_time_)
+{
+	// the point as a ray against circle_ standing still
+	const Vec2 vel = point_vel_ - circle_vel_;
+	if (!PointCircleSweep(point_.x, point_.y, vel.x, vel.y, circle_.center.x, circle_.center.y, circle_.radius, inter_time_))
+	{ return false; }
+	inter_pt_ = point_ + inter_time_ * point_vel_;
+	return true;
+}
+
+//
+bool CDDynamic_RectPoint(const Rect rect_, const Vec2 rect_vel_, const Pt2 point_, const Vec2 point_vel_,
+	Pt2& inter_pt_, float& inter_time_)
+{
+	const Vec2 vel = point_vel_ - rect_vel_;
+	if (!PointAABBSweep(point_.x, point_.y, vel.x, vel.y, AABB(rect_), inter_time_))
+	{ return false; }
+	inter_pt_ = point_ + inter_time_ * point_vel_;
+	return true;
+}
+
+//
+bool CDDynamic_RectRect(const AABB aabb_0_, const Vec2 aabb_vel_0_, const AABB aabb_1_, const Vec2 aabb_vel_1_,
+	float& inter_time_, float& exit_time_, Vec2& normal_)
+{
+	// aabb_1_ moving relative to a stationary aabb_0_
+	const Vec2 vel = aabb_vel_1_ - aabb_vel_0_;
+	const Vec2 inv_vel(SafeInverse(vel.x), SafeInverse(vel.y));
+	return AABBSweep(aabb_0_.min.x, aabb_0_.min.y, aabb_0_.max.x, aabb_0_.max.y, aabb_1_, vel, inv_vel,
+		inter_time_, exit_time_, normal_);
+}
+
+//
+void CDDynamic_CirclePointBatch(uint8_t* hits_, float* inter_time_, const Circle circle_, const Vec2 circle_vel_,
+	const Vec2Stream& points_, const Vec2Stream& point_vels_)
+{
+	if (point_vels_.Size() != points_.Size())
+	{ throw "Size mismatch in CDDynamic_CirclePointBatch()"; }
+	const size_t n = points_.Size();
+	switch (SIMDGetLevel())
+	{
+	#if SIMD_X86
+	case SIMDLevel::AVX2: CirclePointSweepAVX2(hits_, inter_time_, circle_, circle_vel_, points_, point_vels_, n); break;
+	case SIMDLevel::SSE: CirclePointSweepSSE(hits_, inter_time_, circle_, circle_vel_, points_, point_vels_, n); break;
+	#endif
+	default: CirclePointSweepScalar(hits_, inter_time_, circle_, circle_vel_, points_, point_vels_, 0, n); break;
+	}
+}
+
+//
+void CDDynamic_RectPointBatch(uint8_t* hits_, float* inter_time_, const AABB aabb_, const Vec2 aabb_vel_,
+	const Vec2Stream& points_, const Vec2Stream& point_vels_)
+{
+	if (point_vels_.Size() != points_.Size())
+	{ throw "Size mismatch in CDDynamic_RectPointBatch()"; }
+	const size_t n = points_.Size();
+	switch (SIMDGetLevel())
+	{
+	#if SIMD_X86
+	case SIMDLevel::AVX2: AABBPointSweepAVX2(hits_, inter_time_, aabb_, aabb_vel_, points_, point_vels_, n); break;
+	case SIMDLevel::SSE: AABBPointSweepSSE(hits_, inter_time_, aabb_, aabb_vel_, points_, point_vels_, n); break;
+	#endif
+	default: AABBPointSweepScalar(hits_, inter_time_, aabb_, aabb_vel_, points_, point_vels_, 0, n); break;
+	}
+}
+
+//
+void CDDynamic_RectRectBatch(uint8_t* hits_, float* inter_time_, float* normal_x_, float* normal_y_, const AABB aabb_,
+	const Vec2 aabb_vel_, const AABBStream& boxes_)
+{
+	const size_t n = boxes_.Size();
+	switch (SIMDGetLevel())
+	{
+	#if SIMD_X86
+	case SIMDLevel::AVX2: AABBSweepAVX2(hits_, inter_time_, normal_x_, normal_y_, aabb_, aabb_vel_, boxes_, n); break;
+	case SIMDLevel::SSE: AABBSweepSSE(hits_, inter_time_, normal_x_, normal_y_, aabb_, aabb_vel_, boxes_, n); break;
+	#endif
+	default: AABBSweepScalar(hits_, inter_time_, normal_x_, normal_y_, aabb_, aabb_vel_, boxes_, 0, n); break;
+	}
+}
+
 //
 bool CDDynamic_CircleCircle(const Circle circle_0_, const Vec2 circle_vel_0_, const Circle circle_1_, const Vec2 circle_vel_1_,
 	Pt2& inter_pt_A_, Pt2& inter_pt_B_, float& inter_time_)
@@ -121,3 +2185,85 @@ bool CDDynamic_CircleCircle(const Circle circle_0_, const Vec2 circle_vel_0_, co
 	}
 	return false;
 }
+
+//
+bool CDDynamic_OBBOBB(const OBB2D obb_0_, const Vec2 obb_vel_0_, const OBB2D obb_1_, const Vec2 obb_vel_1_,
+	float& inter_time_)
+{
+	Vec2 axes[4];
+	float radii[4];
+	OBBAxes(obb_0_, obb_1_, axes, radii);
+
+	// obb_1_ moving relative to a stationary obb_0_, the projections overlap
+	// on every axis at once or not at all, clipped to the frame
+	const Vec2 dist = obb_1_.center - obb_0_.center;
+	const Vec2 vel = obb_vel_1_ - obb_vel_0_;
+	float enter{ 0 }, exit{ 1 };
+	for (size_t i{ 0 }; i < 4; ++i)
+	{
+		const float proj = Vector2DDotProduct(dist, axes[i]);
+		const float speed = Vector2DDotProduct(vel, axes[i]);
+		if (fabsf(speed) < SLAB_TINY)
+		{
+			// no motion along this axis, it separates for the whole frame or never, as in AxisSweep()
+			if (fabsf(proj) >= radii[i])
+			{ return false; }
+			continue;
+		}
+
+		float t0 = (-radii[i] - proj) / speed, t1 = (radii[i] - proj) / speed;
+		if (t0 > t1)
+		{ std::swap(t0, t1); }
+		enter = fmaxf(enter, t0);
+		exit = fminf(exit, t1);
+		if (enter >= exit)
+		{ return false; }
+	}
+	inter_time_ = enter;
+	return true;
+}
+
+//
+bool CDDynamic_CircleCapsule(const Circle circle_, const Vec2 circle_vel_, const Capsule2D capsule_, float& inter_time_)
+{
+	if (CDStatic_CircleCapsule(circle_, capsule_))
+	{
+		inter_time_ = 0;
+		return true;
+	}
+	if (circle_vel_.LengthSq() <= VEC2_EPSILON * VEC2_EPSILON)
+	{ return false; }
+
+	// circle_'s center as a ray against the capsule grown by circle_'s radius:
+	// the first of the two end caps and the two sides it reaches
+	const float radius = capsule_.radius + circle_.radius;
+	const Ray ray{ circle_.center, circle_vel_ };
+	float first{ 2 }, t{ 0 };
+	if (CDStatic_CircleRay(Circle{ capsule_.pt0, radius }, ray, t))
+	{ first = fminf(first, t); }
+	if (CDStatic_CircleRay(Circle{ capsule_.pt1, radius }, ray, t))
+	{ first = fminf(first, t); }
+
+	const Vec2 seg = capsule_.pt1 - capsule_.pt0;
+	const float len = seg.Length();
+	if (len > VEC2_EPSILON)
+	{
+		const Vec2 dir = seg * (1.0f / len);
+		const Vec2 normal{ dir.y, -dir.x };
+		const float side = Vector2DDotProduct(normal, circle_.center - capsule_.pt0);
+		const float speed = Vector2DDotProduct(normal, circle_vel_);
+		// only the side facing the circle, and only if it moves towards it
+		if (side * speed < 0)
+		{
+			t = ((side > 0 ? radius : -radius) - side) / speed;
+			const float along = Vector2DDotProduct(dir, circle_.center + circle_vel_ * t - capsule_.pt0);
+			if (0 <= t && t <= 1 && 0 <= along && along <= len)
+			{ first = fminf(first, t); }
+		}
+	}
+
+	if (first > 1)
+	{ return false; }
+	inter_time_ = first;
+	return true;
+}
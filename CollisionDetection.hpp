@@ -2,6 +2,12 @@
 #ifndef COLLISION_DETECTION_HPP_
 #define COLLISION_DETECTION_HPP_
 
+#include "AABBStream.hpp"
+#include "CircleStream.hpp"
+#include "LineSegmentStream.hpp"
+#include "OBB2DStream.hpp"
+#include "Vec2Stream.hpp"
+#include <cstdint> // uint8_t
 #include "Types.hpp"
 
 /* STATIC INTERACTIONS */
@@ -12,28 +18,199 @@ bool CDStatic_CirclePoint(const Circle circle_, const Pt2 point_);
 // 
 bool CDStatic_RectPoint(const Rect rect_, const Pt2 point_);
 
+// same as the Rect version without converting, boundary included
+bool CDStatic_RectPoint(const AABB aabb_, const Pt2 point_);
+
 // 
 bool CDStatic_CircleCircle(const Circle circle_0_, const Circle circle_1_);
 
 // 
 bool CDStatic_RectRect_AABB(const Rect rect_0_, const Rect rect_1_);
 
+// boxes that only touch do not overlap
+bool CDStatic_RectRect_AABB(const AABB aabb_0_, const AABB aabb_1_);
+
 //
 bool CDStatic_CircleRect(const Circle circle_, const Rect rect_);
 
+// touching counts as a hit
+bool CDStatic_CircleRect(const Circle circle_, const AABB aabb_);
+
+// closest_ is the point of aabb_ nearest circle_'s center, on the nearest side when the center is
+// inside. depth_ is how far circle_ reaches past it, negative for the gap when apart. Both always written
+bool CDStatic_CircleRect(const Circle circle_, const AABB aabb_, Pt2& closest_, float& depth_);
+
 //
 bool CDStatic_CircleRay(const Circle circle_, const Ray ray_, float& inter_time_);
 
-/* DYNAMIC INTERACTIONS */
+// touching counts as a hit
+bool CDStatic_CircleLineSegment(const Circle circle_, const LineSegment segment_);
+
+// boundary included
+bool CDStatic_OBBPoint(const OBB2D obb_, const Pt2 point_);
+
+// touching counts as a hit
+bool CDStatic_CircleOBB(const Circle circle_, const OBB2D obb_);
+
+// mtv_ is the shortest move that takes circle_ out of obb_, only written on a hit
+bool CDStatic_CircleOBB(const Circle circle_, const OBB2D obb_, Vec2& mtv_);
+
+// separating axis test with an early out, boxes that only touch do not overlap
+bool CDStatic_OBBOBB(const OBB2D obb_0_, const OBB2D obb_1_);
+
+// mtv_ is the shortest move that takes obb_0_ out of obb_1_, only written on a hit
+bool CDStatic_OBBOBB(const OBB2D obb_0_, const OBB2D obb_1_, Vec2& mtv_);
+
+//
+bool CDStatic_OBBAABB(const OBB2D obb_, const AABB aabb_);
+
+// mtv_ is the shortest move that takes obb_ out of aabb_, only written on a hit
+bool CDStatic_OBBAABB(const OBB2D obb_, const AABB aabb_, Vec2& mtv_);
+
+// touching counts as a hit for all the capsule tests
+bool CDStatic_CircleCapsule(const Circle circle_, const Capsule2D capsule_);
 
 //
-bool CDDynamic_CirclePoint(const Circle circle_, const Vec2 circle_vel_, const Pt2 point_, const Vec2 point_vel_);
+bool CDStatic_CapsuleCapsule(const Capsule2D capsule_0_, const Capsule2D capsule_1_);
+
+// closest_0_ and closest_1_ are the closest points of the two core segments, always written.
+// The gap between the surfaces is their distance minus both radii, negative when overlapping
+bool CDStatic_CapsuleCapsule(const Capsule2D capsule_0_, const Capsule2D capsule_1_, Pt2& closest_0_, Pt2& closest_1_);
 
 //
-bool CDDynamic_RectPoint(const Rect rect_, const Vec2 rect_vel_, const Pt2 point_, const Vec2 point_vel_);
+bool CDStatic_CapsuleLineSegment(const Capsule2D capsule_, const LineSegment segment_);
+
+//
+bool CDStatic_CapsuleAABB(const Capsule2D capsule_, const AABB aabb_);
+
+// separating axis test over both polygons' edge normals, polygons that only touch do not overlap
+bool CDStatic_PolygonPolygon(const ConvexPolygon2D& polygon_0_, const ConvexPolygon2D& polygon_1_);
+
+// axis_cache_ keeps the last separating edge for this pair between frames, the edges of
+// polygon_0_ first, then polygon_1_'s. It is tried first and updated when another axis separates
+bool CDStatic_PolygonPolygon(const ConvexPolygon2D& polygon_0_, const ConvexPolygon2D& polygon_1_, size_t& axis_cache_);
+
+// touching counts as a hit
+bool CDStatic_CirclePolygon(const Circle circle_, const ConvexPolygon2D& polygon_);
+
+// touching counts as a hit
+bool CDStatic_CapsulePolygon(const Capsule2D capsule_, const ConvexPolygon2D& polygon_);
+
+// GJK, 0 if the polygons overlap or touch. closest_0_ and closest_1_ are the closest points
+// of each polygon, always written
+float CDStatic_PolygonDistance(const ConvexPolygon2D& polygon_0_, const ConvexPolygon2D& polygon_1_,
+	Pt2& closest_0_, Pt2& closest_1_);
+
+// GJK then EPA, mtv_ is the shortest move that takes polygon_0_ out of polygon_1_, only written on a hit
+bool CDStatic_PolygonPenetration(const ConvexPolygon2D& polygon_0_, const ConvexPolygon2D& polygon_1_, Vec2& mtv_);
+
+/* BATCH STATIC INTERACTIONS */
+// dispatch on SIMDGetLevel(), results come out in ascending index order
+
+// writes the index of every segment circle_ touches to hits_, which holds at
+// least segments_.Size() entries, and returns how many were written
+size_t CDStatic_CircleLineSegmentBatch(size_t* hits_, const Circle circle_, const LineSegmentStream& segments_);
+
+// bit i % 8 of hits_[i / 8] is set if aabb_ overlaps box i, hits_ holds at least
+// (boxes_.Size() + 7) / 8 bytes, bits past the end of the last byte are cleared
+void CDStatic_RectRect_AABBBatch(uint8_t* hits_, const AABB aabb_, const AABBStream& boxes_);
+
+// same bitmask layout as CDStatic_RectRect_AABBBatch()
+void CDStatic_CircleRectBatch(uint8_t* hits_, const Circle circle_, const AABBStream& boxes_);
+
+// many circles against one box, same bitmask layout
+void CDStatic_CircleRectBatch(uint8_t* hits_, const CircleStream& circles_, const AABB aabb_);
+
+// the contact forms of the two above, closest_x_, closest_y_ and depth_ hold Size() floats
+// and are written for every element as in CDStatic_CircleRect()
+void CDStatic_CircleRectBatch(uint8_t* hits_, float* closest_x_, float* closest_y_, float* depth_, const Circle circle_,
+	const AABBStream& boxes_);
+
+//
+void CDStatic_CircleRectBatch(uint8_t* hits_, float* closest_x_, float* closest_y_, float* depth_,
+	const CircleStream& circles_, const AABB aabb_);
+
+// same bitmask layout as CDStatic_RectRect_AABBBatch(), all four axes per box without an early out
+void CDStatic_OBBOBBBatch(uint8_t* hits_, const OBB2D obb_, const OBB2DStream& boxes_);
+
+// same bitmask layout as CDStatic_RectRect_AABBBatch(), touching does not count like CDStatic_CircleCircle()
+void CDStatic_CircleCircleBatch(uint8_t* hits_, const Circle circle_, const CircleStream& circles_);
+
+// the index list form: writes the index of every circle circle_ overlaps to hits_, which
+// holds at least circles_.Size() entries, and returns how many were written
+size_t CDStatic_CircleCircleBatch(size_t* hits_, const Circle circle_, const CircleStream& circles_);
+
+// every overlapping pair within circles_, for the small clusters a broadphase hands over.
+// Pair k is pairs_[2 * k] < pairs_[2 * k + 1], pairs_ holds at least Size() * (Size() - 1)
+// entries. The kernels work in tiles of rows, so the pairs are not in ascending order
+size_t CDStatic_CircleCircleAllPairs(size_t* pairs_, const CircleStream& circles_);
+
+// same bitmask layout as CDStatic_RectRect_AABBBatch(), with the times of CDStatic_CircleRay():
+// inter_time_ holds circles_.Size() floats and is only meaningful where the bit is set.
+// The ray is normalized once rather than per circle, throws if ray_.dir is 0
+void CDStatic_CircleRayBatch(uint8_t* hits_, float* inter_time_, const Ray ray_, const CircleStream& circles_);
+
+// the first circle along ray_, the lower index on a tie. inter_time_ and index_ are only written on a hit
+bool CDStatic_CircleRayNearest(const Ray ray_, const CircleStream& circles_, float& inter_time_, size_t& index_);
+
+// the polygon batches are scalar, polygon_ against each of the count_ polygons_ in order.
+// Same bitmask layout as CDStatic_RectRect_AABBBatch(), axis_cache_ is nullptr or one per polygon
+void CDStatic_PolygonPolygonBatch(uint8_t* hits_, const ConvexPolygon2D& polygon_, const ConvexPolygon2D* polygons_,
+	size_t count_, size_t* axis_cache_);
+
+// distance_ holds count_ floats
+void CDStatic_PolygonDistanceBatch(float* distance_, const ConvexPolygon2D& polygon_, const ConvexPolygon2D* polygons_,
+	size_t count_);
+
+// same bitmask layout as CDStatic_RectRect_AABBBatch(), mtv_ holds count_ vectors and is zero where there is no hit
+void CDStatic_PolygonPenetrationBatch(uint8_t* hits_, Vec2* mtv_, const ConvexPolygon2D& polygon_,
+	const ConvexPolygon2D* polygons_, size_t count_);
+
+/* DYNAMIC INTERACTIONS */
+
+// time of impact over one frame, velocities are the displacement over it. inter_pt_ is where
+// the point is at inter_time_, on the circle's edge. A point already inside hits at inter_time_ 0
+bool CDDynamic_CirclePoint(const Circle circle_, const Vec2 circle_vel_, const Pt2 point_, const Vec2 point_vel_,
+	Pt2& inter_pt_, float& inter_time_);
+
+// same as CDDynamic_CirclePoint(), slab test against the rect, boundary included
+bool CDDynamic_RectPoint(const Rect rect_, const Vec2 rect_vel_, const Pt2 point_, const Vec2 point_vel_,
+	Pt2& inter_pt_, float& inter_time_);
+
+// slab test with aabb_1_ moving relative to aabb_0_, touching does not count like CDStatic_RectRect_AABB().
+// inter_time_ and exit_time_ are when the overlap starts and ends within [0, 1], normal_ is the face of
+// aabb_0_ that aabb_1_ comes in through, or 0 if they already overlap at the start
+bool CDDynamic_RectRect(const AABB aabb_0_, const Vec2 aabb_vel_0_, const AABB aabb_1_, const Vec2 aabb_vel_1_,
+	float& inter_time_, float& exit_time_, Vec2& normal_);
 
 //
 bool CDDynamic_CircleCircle(const Circle circle_0_, const Vec2 circle_vel_0_, const Circle circle_1_, const Vec2 circle_vel_1_,
 	Pt2& inter_pt_A_, Pt2& inter_pt_B_, float& inter_time_);
 
+// swept separating axis test over one frame, neither box rotates during it. inter_time_
+// in [0, 1] is the first contact as a fraction of the velocities, 0 if already overlapping
+bool CDDynamic_OBBOBB(const OBB2D obb_0_, const Vec2 obb_vel_0_, const OBB2D obb_1_, const Vec2 obb_vel_1_,
+	float& inter_time_);
+
+// circle_ moving by circle_vel_ over one frame against a stationary capsule_,
+// inter_time_ in [0, 1] is the first contact, 0 if already overlapping
+bool CDDynamic_CircleCapsule(const Circle circle_, const Vec2 circle_vel_, const Capsule2D capsule_, float& inter_time_);
+
+/* BATCH DYNAMIC INTERACTIONS */
+// same bitmask layout as CDStatic_RectRect_AABBBatch(). inter_time_ holds Size() floats and is
+// only meaningful where the bit is set, point i's contact is points_[i] + point_vels_[i] * inter_time_[i]
+
+// many points, particles or bullets, against one moving circle, throws if point_vels_ is not as long as points_
+void CDDynamic_CirclePointBatch(uint8_t* hits_, float* inter_time_, const Circle circle_, const Vec2 circle_vel_,
+	const Vec2Stream& points_, const Vec2Stream& point_vels_);
+
+// takes a Rect as well, through AABB(rect_), and throws the same way
+void CDDynamic_RectPointBatch(uint8_t* hits_, float* inter_time_, const AABB aabb_, const Vec2 aabb_vel_,
+	const Vec2Stream& points_, const Vec2Stream& point_vels_);
+
+// one moving box against many still ones, each as aabb_0_ of CDDynamic_RectRect() with aabb_ as aabb_1_.
+// normal_x_ and normal_y_ hold Size() floats like inter_time_, there is no exit time
+void CDDynamic_RectRectBatch(uint8_t* hits_, float* inter_time_, float* normal_x_, float* normal_y_, const AABB aabb_,
+	const Vec2 aabb_vel_, const AABBStream& boxes_);
+
 #endif // COLLISION_DETECTION_HPP_
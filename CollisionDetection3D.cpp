@@ -0,0 +1,1118 @@
+//
+#include "CollisionDetection3D.hpp"
+
+#include <corecrt_math.h> // sqrtf(), fabsf(), copysignf()
+
+namespace
+{
+	// stands in for a 0 component of a ray direction, so the slab distances
+	// stay finite instead of turning into 0 * inf = NaN
+	constexpr float SLAB_TINY = 1e-30f;
+
+	//
+	float SafeInverse(const float dir_)
+	{ return 1.0f / (fabsf(dir_) < SLAB_TINY ? copysignf(SLAB_TINY, dir_) : dir_); }
+
+	//
+	Vec3 SafeInverse(const Vec3& dir_)
+	{ return { SafeInverse(dir_.x), SafeInverse(dir_.y), SafeInverse(dir_.z) }; }
+
+	// bit i_ % 8 of hits_[i_ / 8], the byte is cleared on its first bit
+	void SetHit(uint8_t* hits_, const size_t i_, const bool hit_)
+	{
+		if (i_ % 8 == 0)
+		{ hits_[i_ / 8] = 0; }
+		hits_[i_ / 8] |= static_cast<uint8_t>(hit_ << (i_ % 8));
+	}
+
+	// pt_ + dir_ * t against a sphere, Ericson 5.3.2 with dir_ left unnormalized.
+	// A dir_ of 0 only hits from inside, which is what a still sphere wants
+	bool RaySphere(const Pt3& pt_, const Vec3& dir_, const Pt3& center_, const float radius_, float& inter_time_)
+	{
+		const Vec3 m = pt_ - center_;
+		const float a = Vector3DDotProduct(dir_, dir_), b = Vector3DDotProduct(m, dir_);
+		const float c = Vector3DDotProduct(m, m) - radius_ * radius_;
+		if (c < 0)
+		{
+			inter_time_ = 0;
+			return true;
+		}
+		const float disc = b * b - a * c;
+		if (b >= 0 || disc < 0)
+		{ return false; }
+		inter_time_ = (-b - sqrtf(disc)) / a;
+		return inter_time_ <= 1;
+	}
+
+	// inv_dir_ from SafeInverse(), the entry time clamped to [0, 1]
+	bool RayAABB3(const Pt3& pt_, const Vec3& inv_dir_, const AABB3& aabb_, float& inter_time_)
+	{
+		float t_enter{ 0 }, t_exit{ 1 };
+		for (size_t i{ 0 }; i < 3; ++i)
+		{
+			const float t0 = (aabb_.min.m[i] - pt_.m[i]) * inv_dir_.m[i];
+			const float t1 = (aabb_.max.m[i] - pt_.m[i]) * inv_dir_.m[i];
+			t_enter = fmaxf(t_enter, fminf(t0, t1));
+			t_exit = fminf(t_exit, fmaxf(t0, t1));
+		}
+		inter_time_ = t_enter;
+		return t_enter <= t_exit;
+	}
+
+	// the sphere meets the plane when its signed distance reaches the radius on the
+	// side it starts from. A ray is a sphere of radius 0
+	bool SpherePlane(const Pt3& center_, const Vec3& vel_, const float radius_, const Plane& plane_, float& inter_time_)
+	{
+		const float dist = Vector3DDotProduct(plane_.normal, center_) - plane_.offset;
+		const float speed = Vector3DDotProduct(plane_.normal, vel_);
+		if (fabsf(dist) < radius_)
+		{
+			inter_time_ = 0;
+			return true;
+		}
+		if (dist * speed > 0 || speed == 0)
+		{ return false; }
+		inter_time_ = (copysignf(radius_, dist) - dist) / speed;
+		return 0 <= inter_time_ && inter_time_ <= 1;
+	}
+
+	// the rotation of obb_1_ into obb_0_'s frame, the offset between centers in that frame and
+	// the absolute rotation. EPSILON keeps the cross products of near-parallel edges from
+	// separating boxes that overlap
+	struct OBB3Frame
+	{
+		float rot[3][3];
+		float abs_rot[3][3];
+		float offset[3];
+
+		OBB3Frame(const OBB3& obb_0_, const OBB3& obb_1_)
+		{
+			constexpr float EPSILON = 1e-6f;
+			const Vec3 d = obb_1_.center - obb_0_.center;
+			for (size_t i{ 0 }; i < 3; ++i)
+			{
+				const Vec3 axis = obb_0_.Axis(i);
+				for (size_t j{ 0 }; j < 3; ++j)
+				{
+					rot[i][j] = Vector3DDotProduct(axis, obb_1_.Axis(j));
+					abs_rot[i][j] = fabsf(rot[i][j]) + EPSILON;
+				}
+				offset[i] = Vector3DDotProduct(d, axis);
+			}
+		}
+	};
+
+	// axis_ as in CDStatic_OBB3OBB3(), cross products are obb_0_ axis (axis_ - 6) / 3
+	// with obb_1_ axis (axis_ - 6) % 3
+	bool OBB3Separates(const Vec3& half_0_, const Vec3& half_1_, const OBB3Frame& frame_, const size_t axis_)
+	{
+		const float* e0 = half_0_.m, * e1 = half_1_.m;
+		const auto& r = frame_.rot, & ar = frame_.abs_rot;
+		const float* t = frame_.offset;
+		float r0, r1, dist;
+		if (axis_ < 3)
+		{
+			const size_t i = axis_;
+			r0 = e0[i];
+			r1 = e1[0] * ar[i][0] + e1[1] * ar[i][1] + e1[2] * ar[i][2];
+			dist = t[i];
+		}
+		else if (axis_ < 6)
+		{
+			const size_t j = axis_ - 3;
+			r0 = e0[0] * ar[0][j] + e0[1] * ar[1][j] + e0[2] * ar[2][j];
+			r1 = e1[j];
+			dist = t[0] * r[0][j] + t[1] * r[1][j] + t[2] * r[2][j];
+		}
+		else
+		{
+			const size_t i = (axis_ - 6) / 3, i1 = (i + 1) % 3, i2 = (i + 2) % 3;
+			const size_t j = (axis_ - 6) % 3, j1 = (j + 1) % 3, j2 = (j + 2) % 3;
+			r0 = e0[i1] * ar[i2][j] + e0[i2] * ar[i1][j];
+			r1 = e1[j1] * ar[i][j2] + e1[j2] * ar[i][j1];
+			dist = t[i2] * r[i1][j] - t[i1] * r[i2][j];
+		}
+		return fabsf(dist) >= r0 + r1;
+	}
+
+	// vec_ along obb_'s axes, pass an offset from obb_.center for a point
+	Vec3 OBB3Local(const OBB3& obb_, const Vec3& vec_)
+	{ return { Vector3DDotProduct(vec_, obb_.Axis(0)), Vector3DDotProduct(vec_, obb_.Axis(1)), Vector3DDotProduct(vec_, obb_.Axis(2)) }; }
+
+	/* SCALAR KERNELS */
+	// also used for the tails of the SIMD kernels, hence begin_
+
+	//
+	void SphereSphereScalar(uint8_t* hits_, const Sphere& sphere_, const SphereStream& spheres_, size_t begin_, const size_t n_)
+	{
+		for (; begin_ < n_; ++begin_)
+		{
+			const float dx = spheres_.center_x[begin_] - sphere_.center.x;
+			const float dy = spheres_.center_y[begin_] - sphere_.center.y;
+			const float dz = spheres_.center_z[begin_] - sphere_.center.z;
+			const float sum = sphere_.radius + spheres_.radius[begin_];
+			SetHit(hits_, begin_, sum * sum > dx * dx + dy * dy + dz * dz);
+		}
+	}
+
+	// distance to the clamped center, no branches
+	void SphereAABB3Scalar(uint8_t* hits_, const Sphere& sphere_, const AABB3Stream& boxes_, size_t begin_, const size_t n_)
+	{
+		const float radius_sq = sphere_.radius * sphere_.radius;
+		for (; begin_ < n_; ++begin_)
+		{
+			const float dx = sphere_.center.x - fminf(fmaxf(sphere_.center.x, boxes_.min_x[begin_]), boxes_.max_x[begin_]);
+			const float dy = sphere_.center.y - fminf(fmaxf(sphere_.center.y, boxes_.min_y[begin_]), boxes_.max_y[begin_]);
+			const float dz = sphere_.center.z - fminf(fmaxf(sphere_.center.z, boxes_.min_z[begin_]), boxes_.max_z[begin_]);
+			SetHit(hits_, begin_, dx * dx + dy * dy + dz * dz <= radius_sq);
+		}
+	}
+
+	//
+	void AABB3AABB3Scalar(uint8_t* hits_, const AABB3& aabb_, const AABB3Stream& boxes_, size_t begin_, const size_t n_)
+	{
+		for (; begin_ < n_; ++begin_)
+		{
+			SetHit(hits_, begin_, aabb_.min.x < boxes_.max_x[begin_] && boxes_.min_x[begin_] < aabb_.max.x &&
+				aabb_.min.y < boxes_.max_y[begin_] && boxes_.min_y[begin_] < aabb_.max.y &&
+				aabb_.min.z < boxes_.max_z[begin_] && boxes_.min_z[begin_] < aabb_.max.z);
+		}
+	}
+
+	// radius_ is added to every sphere, which turns the swept sphere into a ray
+	void RaySphereScalar(uint8_t* hits_, float* inter_time_, const Ray3& ray_, const float radius_, const SphereStream& spheres_,
+		size_t begin_, const size_t n_)
+	{
+		for (; begin_ < n_; ++begin_)
+		{
+			const Pt3 center{ spheres_.center_x[begin_], spheres_.center_y[begin_], spheres_.center_z[begin_] };
+			SetHit(hits_, begin_, RaySphere(ray_.pt, ray_.dir, center, spheres_.radius[begin_] + radius_, inter_time_[begin_]));
+		}
+	}
+
+	//
+	void RayAABB3Scalar(uint8_t* hits_, float* inter_time_, const Pt3& pt_, const Vec3& inv_dir_, const AABB3Stream& boxes_,
+		size_t begin_, const size_t n_)
+	{
+		for (; begin_ < n_; ++begin_)
+		{ SetHit(hits_, begin_, RayAABB3(pt_, inv_dir_, boxes_.Get(begin_), inter_time_[begin_])); }
+	}
+
+	// a ray is radius_ 0
+	void SpherePlaneScalar(uint8_t* hits_, float* inter_time_, const Sphere& sphere_, const Vec3& vel_, const PlaneStream& planes_,
+		size_t begin_, const size_t n_)
+	{
+		for (; begin_ < n_; ++begin_)
+		{ SetHit(hits_, begin_, SpherePlane(sphere_.center, vel_, sphere_.radius, planes_.Get(begin_), inter_time_[begin_])); }
+	}
+
+	#if SIMD_X86
+	/* SSE KERNELS */
+	// a 4-wide block per call, two blocks per byte of hits_
+
+	// s_ holds the center and the radius
+	SIMD_TARGET_SSE __m128 SphereSphereSSE(const __m128 (&s_)[4], const SphereStream& spheres_, const size_t i_)
+	{
+		const __m128 dx = _mm_sub_ps(_mm_load_ps(spheres_.center_x + i_), s_[0]);
+		const __m128 dy = _mm_sub_ps(_mm_load_ps(spheres_.center_y + i_), s_[1]);
+		const __m128 dz = _mm_sub_ps(_mm_load_ps(spheres_.center_z + i_), s_[2]);
+		const __m128 sum = _mm_add_ps(s_[3], _mm_load_ps(spheres_.radius + i_));
+		const __m128 dist_sq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+		return _mm_cmpgt_ps(_mm_mul_ps(sum, sum), dist_sq);
+	}
+
+	//
+	SIMD_TARGET_SSE void SphereSphereSSE(uint8_t* hits_, const Sphere& sphere_, const SphereStream& spheres_, const size_t n_)
+	{
+		const __m128 s[4]{ _mm_set1_ps(sphere_.center.x), _mm_set1_ps(sphere_.center.y), _mm_set1_ps(sphere_.center.z),
+			_mm_set1_ps(sphere_.radius) };
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const int lo = _mm_movemask_ps(SphereSphereSSE(s, spheres_, i));
+			const int hi = _mm_movemask_ps(SphereSphereSSE(s, spheres_, i + 4));
+			hits_[i / 8] = static_cast<uint8_t>(lo | hi << 4);
+		}
+		SphereSphereScalar(hits_, sphere_, spheres_, i, n_);
+	}
+
+	// s_ holds the center and the squared radius
+	SIMD_TARGET_SSE __m128 SphereAABB3SSE(const __m128 (&s_)[4], const AABB3Stream& boxes_, const size_t i_)
+	{
+		const __m128 dx = _mm_sub_ps(s_[0], _mm_min_ps(_mm_max_ps(s_[0], _mm_load_ps(boxes_.min_x + i_)), _mm_load_ps(boxes_.max_x + i_)));
+		const __m128 dy = _mm_sub_ps(s_[1], _mm_min_ps(_mm_max_ps(s_[1], _mm_load_ps(boxes_.min_y + i_)), _mm_load_ps(boxes_.max_y + i_)));
+		const __m128 dz = _mm_sub_ps(s_[2], _mm_min_ps(_mm_max_ps(s_[2], _mm_load_ps(boxes_.min_z + i_)), _mm_load_ps(boxes_.max_z + i_)));
+		const __m128 dist_sq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+		return _mm_cmple_ps(dist_sq, s_[3]);
+	}
+
+	//
+	SIMD_TARGET_SSE void SphereAABB3SSE(uint8_t* hits_, const Sphere& sphere_, const AABB3Stream& boxes_, const size_t n_)
+	{
+		const __m128 s[4]{ _mm_set1_ps(sphere_.center.x), _mm_set1_ps(sphere_.center.y), _mm_set1_ps(sphere_.center.z),
+			_mm_set1_ps(sphere_.radius * sphere_.radius) };
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const int lo = _mm_movemask_ps(SphereAABB3SSE(s, boxes_, i));
+			const int hi = _mm_movemask_ps(SphereAABB3SSE(s, boxes_, i + 4));
+			hits_[i / 8] = static_cast<uint8_t>(lo | hi << 4);
+		}
+		SphereAABB3Scalar(hits_, sphere_, boxes_, i, n_);
+	}
+
+	// a_ holds min x, y, z then max x, y, z
+	SIMD_TARGET_SSE __m128 AABB3AABB3SSE(const __m128 (&a_)[6], const AABB3Stream& boxes_, const size_t i_)
+	{
+		const __m128 x = _mm_and_ps(_mm_cmplt_ps(a_[0], _mm_load_ps(boxes_.max_x + i_)), _mm_cmplt_ps(_mm_load_ps(boxes_.min_x + i_), a_[3]));
+		const __m128 y = _mm_and_ps(_mm_cmplt_ps(a_[1], _mm_load_ps(boxes_.max_y + i_)), _mm_cmplt_ps(_mm_load_ps(boxes_.min_y + i_), a_[4]));
+		const __m128 z = _mm_and_ps(_mm_cmplt_ps(a_[2], _mm_load_ps(boxes_.max_z + i_)), _mm_cmplt_ps(_mm_load_ps(boxes_.min_z + i_), a_[5]));
+		return _mm_and_ps(_mm_and_ps(x, y), z);
+	}
+
+	//
+	SIMD_TARGET_SSE void AABB3AABB3SSE(uint8_t* hits_, const AABB3& aabb_, const AABB3Stream& boxes_, const size_t n_)
+	{
+		const __m128 a[6]{ _mm_set1_ps(aabb_.min.x), _mm_set1_ps(aabb_.min.y), _mm_set1_ps(aabb_.min.z),
+			_mm_set1_ps(aabb_.max.x), _mm_set1_ps(aabb_.max.y), _mm_set1_ps(aabb_.max.z) };
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const int lo = _mm_movemask_ps(AABB3AABB3SSE(a, boxes_, i));
+			const int hi = _mm_movemask_ps(AABB3AABB3SSE(a, boxes_, i + 4));
+			hits_[i / 8] = static_cast<uint8_t>(lo | hi << 4);
+		}
+		AABB3AABB3Scalar(hits_, aabb_, boxes_, i, n_);
+	}
+
+	// RaySphere() without the branches, r_ holds the point, the direction, dot(dir, dir)
+	// and the radius added to every sphere
+	SIMD_TARGET_SSE __m128 RaySphereSSE(float* inter_time_, const __m128 (&r_)[8], const SphereStream& spheres_, const size_t i_)
+	{
+		const __m128 mx = _mm_sub_ps(r_[0], _mm_load_ps(spheres_.center_x + i_));
+		const __m128 my = _mm_sub_ps(r_[1], _mm_load_ps(spheres_.center_y + i_));
+		const __m128 mz = _mm_sub_ps(r_[2], _mm_load_ps(spheres_.center_z + i_));
+		const __m128 radius = _mm_add_ps(_mm_load_ps(spheres_.radius + i_), r_[7]);
+		const __m128 b = _mm_add_ps(_mm_add_ps(_mm_mul_ps(mx, r_[3]), _mm_mul_ps(my, r_[4])), _mm_mul_ps(mz, r_[5]));
+		const __m128 m_sq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(mx, mx), _mm_mul_ps(my, my)), _mm_mul_ps(mz, mz));
+		const __m128 c = _mm_sub_ps(m_sq, _mm_mul_ps(radius, radius));
+		const __m128 disc = _mm_sub_ps(_mm_mul_ps(b, b), _mm_mul_ps(r_[6], c));
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 root = _mm_sqrt_ps(_mm_max_ps(disc, zero));
+		const __m128 inside = _mm_cmplt_ps(c, zero);
+		const __m128 t = _mm_div_ps(_mm_sub_ps(_mm_sub_ps(zero, b), root), r_[6]);
+		_mm_storeu_ps(inter_time_ + i_, _mm_andnot_ps(inside, t));
+		const __m128 ahead = _mm_and_ps(_mm_and_ps(_mm_cmplt_ps(b, zero), _mm_cmpge_ps(disc, zero)), _mm_cmple_ps(t, _mm_set1_ps(1)));
+		return _mm_or_ps(inside, ahead);
+	}
+
+	//
+	SIMD_TARGET_SSE void RaySphereSSE(uint8_t* hits_, float* inter_time_, const Ray3& ray_, const float radius_,
+		const SphereStream& spheres_, const size_t n_)
+	{
+		const __m128 r[8]{ _mm_set1_ps(ray_.pt.x), _mm_set1_ps(ray_.pt.y), _mm_set1_ps(ray_.pt.z),
+			_mm_set1_ps(ray_.dir.x), _mm_set1_ps(ray_.dir.y), _mm_set1_ps(ray_.dir.z),
+			_mm_set1_ps(Vector3DDotProduct(ray_.dir, ray_.dir)), _mm_set1_ps(radius_) };
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const int lo = _mm_movemask_ps(RaySphereSSE(inter_time_, r, spheres_, i));
+			const int hi = _mm_movemask_ps(RaySphereSSE(inter_time_, r, spheres_, i + 4));
+			hits_[i / 8] = static_cast<uint8_t>(lo | hi << 4);
+		}
+		RaySphereScalar(hits_, inter_time_, ray_, radius_, spheres_, i, n_);
+	}
+
+	// r_ holds the point and SafeInverse() of the direction
+	SIMD_TARGET_SSE __m128 RayAABB3SSE(float* inter_time_, const __m128 (&r_)[6], const AABB3Stream& boxes_, const size_t i_)
+	{
+		const float* mins[3]{ boxes_.min_x, boxes_.min_y, boxes_.min_z };
+		const float* maxs[3]{ boxes_.max_x, boxes_.max_y, boxes_.max_z };
+		__m128 t_enter = _mm_setzero_ps(), t_exit = _mm_set1_ps(1);
+		for (size_t a{ 0 }; a < 3; ++a)
+		{
+			const __m128 t0 = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(mins[a] + i_), r_[a]), r_[a + 3]);
+			const __m128 t1 = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(maxs[a] + i_), r_[a]), r_[a + 3]);
+			t_enter = _mm_max_ps(t_enter, _mm_min_ps(t0, t1));
+			t_exit = _mm_min_ps(t_exit, _mm_max_ps(t0, t1));
+		}
+		_mm_storeu_ps(inter_time_ + i_, t_enter);
+		return _mm_cmple_ps(t_enter, t_exit);
+	}
+
+	//
+	SIMD_TARGET_SSE void RayAABB3SSE(uint8_t* hits_, float* inter_time_, const Pt3& pt_, const Vec3& inv_dir_,
+		const AABB3Stream& boxes_, const size_t n_)
+	{
+		const __m128 r[6]{ _mm_set1_ps(pt_.x), _mm_set1_ps(pt_.y), _mm_set1_ps(pt_.z),
+			_mm_set1_ps(inv_dir_.x), _mm_set1_ps(inv_dir_.y), _mm_set1_ps(inv_dir_.z) };
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const int lo = _mm_movemask_ps(RayAABB3SSE(inter_time_, r, boxes_, i));
+			const int hi = _mm_movemask_ps(RayAABB3SSE(inter_time_, r, boxes_, i + 4));
+			hits_[i / 8] = static_cast<uint8_t>(lo | hi << 4);
+		}
+		RayAABB3Scalar(hits_, inter_time_, pt_, inv_dir_, boxes_, i, n_);
+	}
+
+	// SpherePlane() without the branches, s_ holds the center, the velocity and the radius
+	SIMD_TARGET_SSE __m128 SpherePlaneSSE(float* inter_time_, const __m128 (&s_)[7], const PlaneStream& planes_, const size_t i_)
+	{
+		const __m128 nx = _mm_load_ps(planes_.normal_x + i_), ny = _mm_load_ps(planes_.normal_y + i_);
+		const __m128 nz = _mm_load_ps(planes_.normal_z + i_);
+		const __m128 dist = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, s_[0]), _mm_mul_ps(ny, s_[1])), _mm_mul_ps(nz, s_[2])),
+			_mm_load_ps(planes_.offset + i_));
+		const __m128 speed = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, s_[3]), _mm_mul_ps(ny, s_[4])), _mm_mul_ps(nz, s_[5]));
+		const __m128 sign = _mm_set1_ps(-0.0f), zero = _mm_setzero_ps();
+		const __m128 inside = _mm_cmplt_ps(_mm_andnot_ps(sign, dist), s_[6]);
+		const __m128 t = _mm_div_ps(_mm_sub_ps(_mm_or_ps(_mm_and_ps(sign, dist), s_[6]), dist), speed);
+		_mm_storeu_ps(inter_time_ + i_, _mm_andnot_ps(inside, t));
+		const __m128 toward = _mm_and_ps(_mm_cmple_ps(_mm_mul_ps(dist, speed), zero), _mm_cmpneq_ps(speed, zero));
+		const __m128 in_frame = _mm_and_ps(_mm_cmple_ps(zero, t), _mm_cmple_ps(t, _mm_set1_ps(1)));
+		return _mm_or_ps(inside, _mm_and_ps(toward, in_frame));
+	}
+
+	//
+	SIMD_TARGET_SSE void SpherePlaneSSE(uint8_t* hits_, float* inter_time_, const Sphere& sphere_, const Vec3& vel_,
+		const PlaneStream& planes_, const size_t n_)
+	{
+		const __m128 s[7]{ _mm_set1_ps(sphere_.center.x), _mm_set1_ps(sphere_.center.y), _mm_set1_ps(sphere_.center.z),
+			_mm_set1_ps(vel_.x), _mm_set1_ps(vel_.y), _mm_set1_ps(vel_.z), _mm_set1_ps(sphere_.radius) };
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const int lo = _mm_movemask_ps(SpherePlaneSSE(inter_time_, s, planes_, i));
+			const int hi = _mm_movemask_ps(SpherePlaneSSE(inter_time_, s, planes_, i + 4));
+			hits_[i / 8] = static_cast<uint8_t>(lo | hi << 4);
+		}
+		SpherePlaneScalar(hits_, inter_time_, sphere_, vel_, planes_, i, n_);
+	}
+
+	/* AVX2 KERNELS */
+	// one byte of hits_ per iteration
+
+	//
+	SIMD_TARGET_AVX2 void SphereSphereAVX2(uint8_t* hits_, const Sphere& sphere_, const SphereStream& spheres_, const size_t n_)
+	{
+		const __m256 cx = _mm256_set1_ps(sphere_.center.x), cy = _mm256_set1_ps(sphere_.center.y);
+		const __m256 cz = _mm256_set1_ps(sphere_.center.z), radius = _mm256_set1_ps(sphere_.radius);
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const __m256 dx = _mm256_sub_ps(_mm256_load_ps(spheres_.center_x + i), cx);
+			const __m256 dy = _mm256_sub_ps(_mm256_load_ps(spheres_.center_y + i), cy);
+			const __m256 dz = _mm256_sub_ps(_mm256_load_ps(spheres_.center_z + i), cz);
+			const __m256 sum = _mm256_add_ps(radius, _mm256_load_ps(spheres_.radius + i));
+			const __m256 dist_sq = _mm256_fmadd_ps(dx, dx, _mm256_fmadd_ps(dy, dy, _mm256_mul_ps(dz, dz)));
+			hits_[i / 8] = static_cast<uint8_t>(_mm256_movemask_ps(_mm256_cmp_ps(_mm256_mul_ps(sum, sum), dist_sq, _CMP_GT_OQ)));
+		}
+		SphereSphereScalar(hits_, sphere_, spheres_, i, n_);
+	}
+
+	//
+	SIMD_TARGET_AVX2 void SphereAABB3AVX2(uint8_t* hits_, const Sphere& sphere_, const AABB3Stream& boxes_, const size_t n_)
+	{
+		const __m256 cx = _mm256_set1_ps(sphere_.center.x), cy = _mm256_set1_ps(sphere_.center.y);
+		const __m256 cz = _mm256_set1_ps(sphere_.center.z), radius_sq = _mm256_set1_ps(sphere_.radius * sphere_.radius);
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const __m256 dx = _mm256_sub_ps(cx, _mm256_min_ps(_mm256_max_ps(cx, _mm256_load_ps(boxes_.min_x + i)), _mm256_load_ps(boxes_.max_x + i)));
+			const __m256 dy = _mm256_sub_ps(cy, _mm256_min_ps(_mm256_max_ps(cy, _mm256_load_ps(boxes_.min_y + i)), _mm256_load_ps(boxes_.max_y + i)));
+			const __m256 dz = _mm256_sub_ps(cz, _mm256_min_ps(_mm256_max_ps(cz, _mm256_load_ps(boxes_.min_z + i)), _mm256_load_ps(boxes_.max_z + i)));
+			const __m256 dist_sq = _mm256_fmadd_ps(dx, dx, _mm256_fmadd_ps(dy, dy, _mm256_mul_ps(dz, dz)));
+			hits_[i / 8] = static_cast<uint8_t>(_mm256_movemask_ps(_mm256_cmp_ps(dist_sq, radius_sq, _CMP_LE_OQ)));
+		}
+		SphereAABB3Scalar(hits_, sphere_, boxes_, i, n_);
+	}
+
+	//
+	SIMD_TARGET_AVX2 void AABB3AABB3AVX2(uint8_t* hits_, const AABB3& aabb_, const AABB3Stream& boxes_, const size_t n_)
+	{
+		const __m256 min_x = _mm256_set1_ps(aabb_.min.x), min_y = _mm256_set1_ps(aabb_.min.y), min_z = _mm256_set1_ps(aabb_.min.z);
+		const __m256 max_x = _mm256_set1_ps(aabb_.max.x), max_y = _mm256_set1_ps(aabb_.max.y), max_z = _mm256_set1_ps(aabb_.max.z);
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const __m256 x = _mm256_and_ps(_mm256_cmp_ps(min_x, _mm256_load_ps(boxes_.max_x + i), _CMP_LT_OQ),
+				_mm256_cmp_ps(_mm256_load_ps(boxes_.min_x + i), max_x, _CMP_LT_OQ));
+			const __m256 y = _mm256_and_ps(_mm256_cmp_ps(min_y, _mm256_load_ps(boxes_.max_y + i), _CMP_LT_OQ),
+				_mm256_cmp_ps(_mm256_load_ps(boxes_.min_y + i), max_y, _CMP_LT_OQ));
+			const __m256 z = _mm256_and_ps(_mm256_cmp_ps(min_z, _mm256_load_ps(boxes_.max_z + i), _CMP_LT_OQ),
+				_mm256_cmp_ps(_mm256_load_ps(boxes_.min_z + i), max_z, _CMP_LT_OQ));
+			hits_[i / 8] = static_cast<uint8_t>(_mm256_movemask_ps(_mm256_and_ps(_mm256_and_ps(x, y), z)));
+		}
+		AABB3AABB3Scalar(hits_, aabb_, boxes_, i, n_);
+	}
+
+	// same as RaySphereSSE(), 8 spheres at a time
+	SIMD_TARGET_AVX2 void RaySphereAVX2(uint8_t* hits_, float* inter_time_, const Ray3& ray_, const float radius_,
+		const SphereStream& spheres_, const size_t n_)
+	{
+		const __m256 ox = _mm256_set1_ps(ray_.pt.x), oy = _mm256_set1_ps(ray_.pt.y), oz = _mm256_set1_ps(ray_.pt.z);
+		const __m256 dx = _mm256_set1_ps(ray_.dir.x), dy = _mm256_set1_ps(ray_.dir.y), dz = _mm256_set1_ps(ray_.dir.z);
+		const __m256 a = _mm256_set1_ps(Vector3DDotProduct(ray_.dir, ray_.dir)), added = _mm256_set1_ps(radius_);
+		const __m256 zero = _mm256_setzero_ps(), one = _mm256_set1_ps(1);
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const __m256 mx = _mm256_sub_ps(ox, _mm256_load_ps(spheres_.center_x + i));
+			const __m256 my = _mm256_sub_ps(oy, _mm256_load_ps(spheres_.center_y + i));
+			const __m256 mz = _mm256_sub_ps(oz, _mm256_load_ps(spheres_.center_z + i));
+			const __m256 radius = _mm256_add_ps(_mm256_load_ps(spheres_.radius + i), added);
+			const __m256 b = _mm256_fmadd_ps(mx, dx, _mm256_fmadd_ps(my, dy, _mm256_mul_ps(mz, dz)));
+			const __m256 m_sq = _mm256_fmadd_ps(mx, mx, _mm256_fmadd_ps(my, my, _mm256_mul_ps(mz, mz)));
+			const __m256 c = _mm256_fnmadd_ps(radius, radius, m_sq);
+			const __m256 disc = _mm256_fmsub_ps(b, b, _mm256_mul_ps(a, c));
+			const __m256 root = _mm256_sqrt_ps(_mm256_max_ps(disc, zero));
+			const __m256 inside = _mm256_cmp_ps(c, zero, _CMP_LT_OQ);
+			const __m256 t = _mm256_div_ps(_mm256_sub_ps(_mm256_sub_ps(zero, b), root), a);
+			_mm256_storeu_ps(inter_time_ + i, _mm256_andnot_ps(inside, t));
+			const __m256 ahead = _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(b, zero, _CMP_LT_OQ), _mm256_cmp_ps(disc, zero, _CMP_GE_OQ)),
+				_mm256_cmp_ps(t, one, _CMP_LE_OQ));
+			hits_[i / 8] = static_cast<uint8_t>(_mm256_movemask_ps(_mm256_or_ps(inside, ahead)));
+		}
+		RaySphereScalar(hits_, inter_time_, ray_, radius_, spheres_, i, n_);
+	}
+
+	//
+	SIMD_TARGET_AVX2 void RayAABB3AVX2(uint8_t* hits_, float* inter_time_, const Pt3& pt_, const Vec3& inv_dir_,
+		const AABB3Stream& boxes_, const size_t n_)
+	{
+		const float* mins[3]{ boxes_.min_x, boxes_.min_y, boxes_.min_z };
+		const float* maxs[3]{ boxes_.max_x, boxes_.max_y, boxes_.max_z };
+		const __m256 pt[3]{ _mm256_set1_ps(pt_.x), _mm256_set1_ps(pt_.y), _mm256_set1_ps(pt_.z) };
+		const __m256 inv_dir[3]{ _mm256_set1_ps(inv_dir_.x), _mm256_set1_ps(inv_dir_.y), _mm256_set1_ps(inv_dir_.z) };
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			__m256 t_enter = _mm256_setzero_ps(), t_exit = _mm256_set1_ps(1);
+			for (size_t a{ 0 }; a < 3; ++a)
+			{
+				const __m256 t0 = _mm256_mul_ps(_mm256_sub_ps(_mm256_load_ps(mins[a] + i), pt[a]), inv_dir[a]);
+				const __m256 t1 = _mm256_mul_ps(_mm256_sub_ps(_mm256_load_ps(maxs[a] + i), pt[a]), inv_dir[a]);
+				t_enter = _mm256_max_ps(t_enter, _mm256_min_ps(t0, t1));
+				t_exit = _mm256_min_ps(t_exit, _mm256_max_ps(t0, t1));
+			}
+			_mm256_storeu_ps(inter_time_ + i, t_enter);
+			hits_[i / 8] = static_cast<uint8_t>(_mm256_movemask_ps(_mm256_cmp_ps(t_enter, t_exit, _CMP_LE_OQ)));
+		}
+		RayAABB3Scalar(hits_, inter_time_, pt_, inv_dir_, boxes_, i, n_);
+	}
+
+	// same as SpherePlaneSSE(), 8 planes at a time
+	SIMD_TARGET_AVX2 void SpherePlaneAVX2(uint8_t* hits_, float* inter_time_, const Sphere& sphere_, const Vec3& vel_,
+		const PlaneStream& planes_, const size_t n_)
+	{
+		const __m256 cx = _mm256_set1_ps(sphere_.center.x), cy = _mm256_set1_ps(sphere_.center.y), cz = _mm256_set1_ps(sphere_.center.z);
+		const __m256 vx = _mm256_set1_ps(vel_.x), vy = _mm256_set1_ps(vel_.y), vz = _mm256_set1_ps(vel_.z);
+		const __m256 radius = _mm256_set1_ps(sphere_.radius);
+		const __m256 sign = _mm256_set1_ps(-0.0f), zero = _mm256_setzero_ps(), one = _mm256_set1_ps(1);
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const __m256 nx = _mm256_load_ps(planes_.normal_x + i), ny = _mm256_load_ps(planes_.normal_y + i);
+			const __m256 nz = _mm256_load_ps(planes_.normal_z + i);
+			const __m256 dist = _mm256_sub_ps(_mm256_fmadd_ps(nx, cx, _mm256_fmadd_ps(ny, cy, _mm256_mul_ps(nz, cz))),
+				_mm256_load_ps(planes_.offset + i));
+			const __m256 speed = _mm256_fmadd_ps(nx, vx, _mm256_fmadd_ps(ny, vy, _mm256_mul_ps(nz, vz)));
+			const __m256 inside = _mm256_cmp_ps(_mm256_andnot_ps(sign, dist), radius, _CMP_LT_OQ);
+			const __m256 t = _mm256_div_ps(_mm256_sub_ps(_mm256_or_ps(_mm256_and_ps(sign, dist), radius), dist), speed);
+			_mm256_storeu_ps(inter_time_ + i, _mm256_andnot_ps(inside, t));
+			const __m256 toward = _mm256_and_ps(_mm256_cmp_ps(_mm256_mul_ps(dist, speed), zero, _CMP_LE_OQ),
+				_mm256_cmp_ps(speed, zero, _CMP_NEQ_OQ));
+			const __m256 in_frame = _mm256_and_ps(_mm256_cmp_ps(zero, t, _CMP_LE_OQ), _mm256_cmp_ps(t, one, _CMP_LE_OQ));
+			hits_[i / 8] = static_cast<uint8_t>(_mm256_movemask_ps(_mm256_or_ps(inside, _mm256_and_ps(toward, in_frame))));
+		}
+		SpherePlaneScalar(hits_, inter_time_, sphere_, vel_, planes_, i, n_);
+	}
+	#endif
+
+	/* TRIANGLE MESH */
+
+	// Moller-Trumbore from either side, inter_time_ along the whole of dir_
+	bool RayTriangle(const Pt3& pt_, const Vec3& dir_, const Pt3& a_, const Pt3& b_, const Pt3& c_, float& inter_time_)
+	{
+		const Vec3 edge_0 = b_ - a_, edge_1 = c_ - a_;
+		const Vec3 p = Vector3DCrossProduct(dir_, edge_1);
+		const float det = Vector3DDotProduct(edge_0, p);
+		if (det == 0)
+		{ return false; }
+		const float inv_det = 1.0f / det;
+		const Vec3 s = pt_ - a_;
+		const float u = Vector3DDotProduct(s, p) * inv_det;
+		if (u < 0 || u > 1)
+		{ return false; }
+		const Vec3 q = Vector3DCrossProduct(s, edge_0);
+		const float v = Vector3DDotProduct(dir_, q) * inv_det;
+		if (v < 0 || u + v > 1)
+		{ return false; }
+		inter_time_ = Vector3DDotProduct(edge_1, q) * inv_det;
+		return 0 <= inter_time_ && inter_time_ <= 1;
+	}
+
+	// Ericson 5.1.5
+	Pt3 ClosestPointTriangle(const Pt3& pt_, const Pt3& a_, const Pt3& b_, const Pt3& c_)
+	{
+		const Vec3 ab = b_ - a_, ac = c_ - a_, ap = pt_ - a_;
+		const float d1 = Vector3DDotProduct(ab, ap), d2 = Vector3DDotProduct(ac, ap);
+		if (d1 <= 0 && d2 <= 0)
+		{ return a_; }
+		const Vec3 bp = pt_ - b_;
+		const float d3 = Vector3DDotProduct(ab, bp), d4 = Vector3DDotProduct(ac, bp);
+		if (d3 >= 0 && d4 <= d3)
+		{ return b_; }
+		const float vc = d1 * d4 - d3 * d2;
+		if (vc <= 0 && d1 >= 0 && d3 <= 0)
+		{ return a_ + ab * (d1 / (d1 - d3)); }
+		const Vec3 cp = pt_ - c_;
+		const float d5 = Vector3DDotProduct(ab, cp), d6 = Vector3DDotProduct(ac, cp);
+		if (d6 >= 0 && d5 <= d6)
+		{ return c_; }
+		const float vb = d5 * d2 - d1 * d6;
+		if (vb <= 0 && d2 >= 0 && d6 <= 0)
+		{ return a_ + ac * (d2 / (d2 - d6)); }
+		const float va = d3 * d6 - d5 * d4;
+		if (va <= 0 && d4 - d3 >= 0 && d5 - d6 >= 0)
+		{ return b_ + (c_ - b_) * ((d4 - d3) / ((d4 - d3) + (d5 - d6))); }
+		const float denom = 1.0f / (va + vb + vc);
+		return a_ + ab * (vb * denom) + ac * (vc * denom);
+	}
+
+	// pt_ + dir_ * t entering the infinite cylinder of radius_ around a_ b_, and only
+	// counted between a_ and b_. From inside or parallel it misses, the corners cover that
+	bool RayCylinder(const Pt3& pt_, const Vec3& dir_, const Pt3& a_, const Pt3& b_, const float radius_, float& inter_time_)
+	{
+		const Vec3 edge = b_ - a_, m = pt_ - a_;
+		const float edge_sq = Vector3DDotProduct(edge, edge);
+		if (edge_sq == 0)
+		{ return false; }
+		const float m_along = Vector3DDotProduct(m, edge), dir_along = Vector3DDotProduct(dir_, edge);
+		const Vec3 m_perp = m - edge * (m_along / edge_sq), dir_perp = dir_ - edge * (dir_along / edge_sq);
+		const float a = Vector3DDotProduct(dir_perp, dir_perp), b = Vector3DDotProduct(m_perp, dir_perp);
+		const float c = Vector3DDotProduct(m_perp, m_perp) - radius_ * radius_;
+		const float disc = b * b - a * c;
+		if (a == 0 || b >= 0 || c < 0 || disc < 0)
+		{ return false; }
+		inter_time_ = (-b - sqrtf(disc)) / a;
+		const float along = (m_along + dir_along * inter_time_) / edge_sq;
+		return inter_time_ <= 1 && 0 <= along && along <= 1;
+	}
+
+	// earliest of the face, the 3 edge cylinders and the 3 corner spheres, 0 if already touching
+	bool SweptSphereTriangle(const Pt3& center_, const Vec3& vel_, const float radius_, const Pt3& a_, const Pt3& b_,
+		const Pt3& c_, float& inter_time_)
+	{
+		if ((ClosestPointTriangle(center_, a_, b_, c_) - center_).LengthSq() <= radius_ * radius_)
+		{
+			inter_time_ = 0;
+			return true;
+		}
+
+		bool hit{ false };
+		float t;
+		const auto earliest = [&](const bool candidate_)
+		{
+			if (candidate_ && (!hit || t < inter_time_))
+			{ inter_time_ = t; hit = true; }
+		};
+		const Vec3 normal = Vector3DCrossProduct(b_ - a_, c_ - a_);
+		const float normal_sq = normal.LengthSq();
+		if (normal_sq > 0)
+		{
+			// the sphere's leading point reaches the plane inside the triangle
+			const Vec3 unit = normal * (1.0f / sqrtf(normal_sq));
+			const float dist = Vector3DDotProduct(unit, center_ - a_), speed = Vector3DDotProduct(unit, vel_);
+			if (dist * speed < 0)
+			{
+				t = (copysignf(radius_, dist) - dist) / speed;
+				const Pt3 contact = center_ + vel_ * t - unit * copysignf(radius_, dist);
+				earliest(0 <= t && t <= 1 &&
+					Vector3DDotProduct(Vector3DCrossProduct(b_ - a_, contact - a_), normal) >= 0 &&
+					Vector3DDotProduct(Vector3DCrossProduct(c_ - b_, contact - b_), normal) >= 0 &&
+					Vector3DDotProduct(Vector3DCrossProduct(a_ - c_, contact - c_), normal) >= 0);
+			}
+		}
+		earliest(RayCylinder(center_, vel_, a_, b_, radius_, t));
+		earliest(RayCylinder(center_, vel_, b_, c_, radius_, t));
+		earliest(RayCylinder(center_, vel_, c_, a_, radius_, t));
+		earliest(RaySphere(center_, vel_, a_, radius_, t));
+		earliest(RaySphere(center_, vel_, b_, radius_, t));
+		earliest(RaySphere(center_, vel_, c_, radius_, t));
+		return hit;
+	}
+
+	// slab test of a BVHNode3D's children grown by expand_, which makes it a swept sphere's.
+	// Returns the mask of children entered before limit_ and their entry times
+	struct RayNodeScalar
+	{
+		Pt3 pt;
+		Vec3 inv_dir;
+		float expand;
+
+		unsigned operator()(const BVHNode3D& node_, const float limit_, float (&enter_)[4]) const
+		{
+			const float* mins[3]{ node_.min_x, node_.min_y, node_.min_z };
+			const float* maxs[3]{ node_.max_x, node_.max_y, node_.max_z };
+			unsigned mask{ 0 };
+			for (size_t i{ 0 }; i < 4; ++i)
+			{
+				float t_enter{ 0 }, t_exit{ limit_ };
+				for (size_t axis{ 0 }; axis < 3; ++axis)
+				{
+					const float t0 = (mins[axis][i] - expand - pt.m[axis]) * inv_dir.m[axis];
+					const float t1 = (maxs[axis][i] + expand - pt.m[axis]) * inv_dir.m[axis];
+					t_enter = fmaxf(t_enter, fminf(t0, t1));
+					t_exit = fminf(t_exit, fmaxf(t0, t1));
+				}
+				enter_[i] = t_enter;
+				mask |= static_cast<unsigned>(t_enter <= t_exit) << i;
+			}
+			return mask;
+		}
+	};
+
+	// distance to the clamped center like CDStatic_SphereAABB3(), every entry time is 0
+	struct SphereNodeScalar
+	{
+		Sphere sphere;
+
+		unsigned operator()(const BVHNode3D& node_, float, float (&enter_)[4]) const
+		{
+			unsigned mask{ 0 };
+			for (size_t i{ 0 }; i < 4; ++i)
+			{
+				const float dx = sphere.center.x - fminf(fmaxf(sphere.center.x, node_.min_x[i]), node_.max_x[i]);
+				const float dy = sphere.center.y - fminf(fmaxf(sphere.center.y, node_.min_y[i]), node_.max_y[i]);
+				const float dz = sphere.center.z - fminf(fmaxf(sphere.center.z, node_.min_z[i]), node_.max_z[i]);
+				enter_[i] = 0;
+				mask |= static_cast<unsigned>(dx * dx + dy * dy + dz * dz <= sphere.radius * sphere.radius) << i;
+			}
+			return mask;
+		}
+	};
+
+	#if SIMD_X86
+	// RayNodeScalar on all 4 children at once, r holds the point, SafeInverse() of the
+	// direction and expand. A node is only 4 wide, so AVX2 has nothing more to add
+	struct RayNodeSSE
+	{
+		__m128 r[7];
+
+		SIMD_TARGET_SSE RayNodeSSE(const RayNodeScalar& scalar_)
+		{
+			for (size_t axis{ 0 }; axis < 3; ++axis)
+			{
+				r[axis] = _mm_set1_ps(scalar_.pt.m[axis]);
+				r[3 + axis] = _mm_set1_ps(scalar_.inv_dir.m[axis]);
+			}
+			r[6] = _mm_set1_ps(scalar_.expand);
+		}
+
+		SIMD_TARGET_SSE unsigned operator()(const BVHNode3D& node_, const float limit_, float (&enter_)[4]) const
+		{
+			const float* mins[3]{ node_.min_x, node_.min_y, node_.min_z };
+			const float* maxs[3]{ node_.max_x, node_.max_y, node_.max_z };
+			__m128 t_enter = _mm_setzero_ps(), t_exit = _mm_set1_ps(limit_);
+			for (size_t axis{ 0 }; axis < 3; ++axis)
+			{
+				const __m128 t0 = _mm_mul_ps(_mm_sub_ps(_mm_sub_ps(_mm_load_ps(mins[axis]), r[6]), r[axis]), r[3 + axis]);
+				const __m128 t1 = _mm_mul_ps(_mm_sub_ps(_mm_add_ps(_mm_load_ps(maxs[axis]), r[6]), r[axis]), r[3 + axis]);
+				t_enter = _mm_max_ps(t_enter, _mm_min_ps(t0, t1));
+				t_exit = _mm_min_ps(t_exit, _mm_max_ps(t0, t1));
+			}
+			_mm_storeu_ps(enter_, t_enter);
+			return static_cast<unsigned>(_mm_movemask_ps(_mm_cmple_ps(t_enter, t_exit)));
+		}
+	};
+
+	// SphereNodeScalar on all 4 children at once, s holds the center and the radius squared
+	struct SphereNodeSSE
+	{
+		__m128 s[4];
+
+		SIMD_TARGET_SSE SphereNodeSSE(const SphereNodeScalar& scalar_)
+		{
+			for (size_t axis{ 0 }; axis < 3; ++axis)
+			{ s[axis] = _mm_set1_ps(scalar_.sphere.center.m[axis]); }
+			s[3] = _mm_set1_ps(scalar_.sphere.radius * scalar_.sphere.radius);
+		}
+
+		SIMD_TARGET_SSE unsigned operator()(const BVHNode3D& node_, float, float (&enter_)[4]) const
+		{
+			const __m128 dx = _mm_sub_ps(s[0], _mm_min_ps(_mm_max_ps(s[0], _mm_load_ps(node_.min_x)), _mm_load_ps(node_.max_x)));
+			const __m128 dy = _mm_sub_ps(s[1], _mm_min_ps(_mm_max_ps(s[1], _mm_load_ps(node_.min_y)), _mm_load_ps(node_.max_y)));
+			const __m128 dz = _mm_sub_ps(s[2], _mm_min_ps(_mm_max_ps(s[2], _mm_load_ps(node_.min_z)), _mm_load_ps(node_.max_z)));
+			const __m128 dist_sq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+			_mm_storeu_ps(enter_, _mm_setzero_ps());
+			return static_cast<unsigned>(_mm_movemask_ps(_mm_cmple_ps(dist_sq, s[3])));
+		}
+	};
+	#endif
+
+	// walks mesh_'s BVH with a fixed stack, the children test_ accepts nearest first.
+	// leaf_(first_, count_, limit_) gets each accepted leaf's run of triangles, may lower
+	// limit_ to prune everything entered after it, and returns false to stop
+	template <typename NodeTest, typename LeafVisit>
+	void TraverseBVH(const TriangleMesh& mesh_, const NodeTest& test_, const LeafVisit& leaf_)
+	{
+		struct Entry
+		{
+			uint32_t node;
+			float enter;
+		};
+		Entry stack[TriangleMesh::MAX_STACK];
+		size_t top{ 0 };
+		float limit{ 1 };
+		if (!mesh_.nodes.empty())
+		{ stack[top++] = { 0, 0 }; }
+		while (top > 0)
+		{
+			const Entry entry = stack[--top];
+			if (entry.enter > limit)
+			{ continue; }
+			const BVHNode3D& node = mesh_.nodes[entry.node];
+			float enter[4];
+			const unsigned mask = test_(node, limit, enter) & ((1u << node.child_count) - 1);
+
+			size_t order[4], count{ 0 };
+			for (size_t i{ 0 }; i < 4; ++i)
+			{
+				if (!(mask >> i & 1))
+				{ continue; }
+				size_t j{ count++ };
+				for (; j > 0 && enter[order[j - 1]] > enter[i]; --j)
+				{ order[j] = order[j - 1]; }
+				order[j] = i;
+			}
+			// leaves first so they can lower limit before anything is pushed,
+			// then the inner children farthest first so the nearest is popped next
+			for (size_t k{ 0 }; k < count; ++k)
+			{
+				const size_t i = order[k];
+				if (node.leaf_count[i] && enter[i] <= limit && !leaf_(node.child[i], node.leaf_count[i], limit))
+				{ return; }
+			}
+			for (size_t k{ count }; k-- > 0;)
+			{
+				const size_t i = order[k];
+				if (!node.leaf_count[i])
+				{ stack[top++] = { node.child[i], enter[i] }; }
+			}
+		}
+	}
+
+	// TraverseBVH() along pt_ + dir_ * t with the boxes grown by expand_
+	template <typename LeafVisit>
+	void TraverseBVHRay(const TriangleMesh& mesh_, const Pt3& pt_, const Vec3& dir_, const float expand_, const LeafVisit& leaf_)
+	{
+		const RayNodeScalar test{ pt_, SafeInverse(dir_), expand_ };
+		switch (SIMDGetLevel())
+		{
+		#if SIMD_X86
+		case SIMDLevel::AVX2:
+		case SIMDLevel::SSE: TraverseBVH(mesh_, RayNodeSSE(test), leaf_); break;
+		#endif
+		default: TraverseBVH(mesh_, test, leaf_); break;
+		}
+	}
+
+	// TraverseBVH() over the boxes sphere_ touches
+	template <typename LeafVisit>
+	void TraverseBVHSphere(const TriangleMesh& mesh_, const Sphere& sphere_, const LeafVisit& leaf_)
+	{
+		const SphereNodeScalar test{ sphere_ };
+		switch (SIMDGetLevel())
+		{
+		#if SIMD_X86
+		case SIMDLevel::AVX2:
+		case SIMDLevel::SSE: TraverseBVH(mesh_, SphereNodeSSE(test), leaf_); break;
+		#endif
+		default: TraverseBVH(mesh_, test, leaf_); break;
+		}
+	}
+}
+
+//
+bool CDStatic_SphereSphere(const Sphere sphere_0_, const Sphere sphere_1_)
+{
+	const float sum = sphere_0_.radius + sphere_1_.radius;
+	return sum * sum > Vector3DSquaredDistance(sphere_0_.center, sphere_1_.center);
+}
+
+//
+bool CDStatic_SphereAABB3(const Sphere sphere_, const AABB3 aabb_)
+{
+	const float dx = sphere_.center.x - fminf(fmaxf(sphere_.center.x, aabb_.min.x), aabb_.max.x);
+	const float dy = sphere_.center.y - fminf(fmaxf(sphere_.center.y, aabb_.min.y), aabb_.max.y);
+	const float dz = sphere_.center.z - fminf(fmaxf(sphere_.center.z, aabb_.min.z), aabb_.max.z);
+	return dx * dx + dy * dy + dz * dz <= sphere_.radius * sphere_.radius;
+}
+
+//
+bool CDStatic_AABB3AABB3(const AABB3 aabb_0_, const AABB3 aabb_1_)
+{
+	return aabb_0_.min.x < aabb_1_.max.x && aabb_1_.min.x < aabb_0_.max.x &&
+		aabb_0_.min.y < aabb_1_.max.y && aabb_1_.min.y < aabb_0_.max.y &&
+		aabb_0_.min.z < aabb_1_.max.z && aabb_1_.min.z < aabb_0_.max.z;
+}
+
+//
+bool CDStatic_RaySphere(const Ray3 ray_, const Sphere sphere_, float& inter_time_)
+{
+	if (ray_.dir.LengthSq() <= VEC3_EPSILON * VEC3_EPSILON)
+	{ throw "Division by 0 in CDStatic_RaySphere()"; }
+	return RaySphere(ray_.pt, ray_.dir, sphere_.center, sphere_.radius, inter_time_);
+}
+
+//
+bool CDStatic_RayAABB3(const Ray3 ray_, const AABB3 aabb_, float& inter_time_)
+{ return RayAABB3(ray_.pt, SafeInverse(ray_.dir), aabb_, inter_time_); }
+
+//
+bool CDStatic_RayPlane(const Ray3 ray_, const Plane plane_, float& inter_time_)
+{ return SpherePlane(ray_.pt, ray_.dir, 0, plane_, inter_time_); }
+
+//
+bool CDStatic_OBB3OBB3(const OBB3& obb_0_, const OBB3& obb_1_)
+{
+	size_t axis_cache{ 0 };
+	return CDStatic_OBB3OBB3(obb_0_, obb_1_, axis_cache);
+}
+
+//
+bool CDStatic_OBB3OBB3(const OBB3& obb_0_, const OBB3& obb_1_, size_t& axis_cache_)
+{
+	const OBB3Frame frame(obb_0_, obb_1_);
+	if (axis_cache_ < 15 && OBB3Separates(obb_0_.half_ext, obb_1_.half_ext, frame, axis_cache_))
+	{ return false; }
+	for (size_t axis{ 0 }; axis < 15; ++axis)
+	{
+		if (axis != axis_cache_ && OBB3Separates(obb_0_.half_ext, obb_1_.half_ext, frame, axis))
+		{
+			axis_cache_ = axis;
+			return false;
+		}
+	}
+	return true;
+}
+
+//
+bool CDStatic_SphereOBB3(const Sphere sphere_, const OBB3& obb_)
+{
+	const Vec3 local = OBB3Local(obb_, sphere_.center - obb_.center);
+	return CDStatic_SphereAABB3({ local, sphere_.radius }, { -obb_.half_ext, obb_.half_ext });
+}
+
+//
+bool CDStatic_RayOBB3(const Ray3 ray_, const OBB3& obb_, float& inter_time_)
+{
+	const Vec3 local_pt = OBB3Local(obb_, ray_.pt - obb_.center), local_dir = OBB3Local(obb_, ray_.dir);
+	return RayAABB3(local_pt, SafeInverse(local_dir), { -obb_.half_ext, obb_.half_ext }, inter_time_);
+}
+
+//
+bool CDStatic_RayTriangleMesh(const Ray3 ray_, const TriangleMesh& mesh_, float& inter_time_, size_t& triangle_)
+{
+	bool hit{ false };
+	TraverseBVHRay(mesh_, ray_.pt, ray_.dir, 0, [&](const uint32_t first_, const size_t count_, float& limit_)
+	{
+		for (size_t i{ first_ }; i < first_ + count_; ++i)
+		{
+			Pt3 a, b, c;
+			float t;
+			mesh_.Triangle(i, a, b, c);
+			if (RayTriangle(ray_.pt, ray_.dir, a, b, c, t) && (!hit || t < limit_))
+			{
+				limit_ = inter_time_ = t;
+				triangle_ = mesh_.triangle_ids[i];
+				hit = true;
+			}
+		}
+		return true;
+	});
+	return hit;
+}
+
+//
+bool CDStatic_RayTriangleMeshAny(const Ray3 ray_, const TriangleMesh& mesh_)
+{
+	bool hit{ false };
+	TraverseBVHRay(mesh_, ray_.pt, ray_.dir, 0, [&](const uint32_t first_, const size_t count_, float&)
+	{
+		for (size_t i{ first_ }; !hit && i < first_ + count_; ++i)
+		{
+			Pt3 a, b, c;
+			float t;
+			mesh_.Triangle(i, a, b, c);
+			hit = RayTriangle(ray_.pt, ray_.dir, a, b, c, t);
+		}
+		return !hit;
+	});
+	return hit;
+}
+
+//
+bool CDStatic_SphereTriangleMesh(const Sphere sphere_, const TriangleMesh& mesh_)
+{
+	size_t triangle;
+	return CDStatic_SphereTriangleMesh(sphere_, mesh_, &triangle, 1) > 0;
+}
+
+//
+size_t CDStatic_SphereTriangleMesh(const Sphere sphere_, const TriangleMesh& mesh_, size_t* triangles_, const size_t max_)
+{
+	size_t count{ 0 };
+	const float radius_sq = sphere_.radius * sphere_.radius;
+	TraverseBVHSphere(mesh_, sphere_, [&](const uint32_t first_, const size_t count_, float&)
+	{
+		for (size_t i{ first_ }; count < max_ && i < first_ + count_; ++i)
+		{
+			Pt3 a, b, c;
+			mesh_.Triangle(i, a, b, c);
+			if ((ClosestPointTriangle(sphere_.center, a, b, c) - sphere_.center).LengthSq() <= radius_sq)
+			{ triangles_[count++] = mesh_.triangle_ids[i]; }
+		}
+		return count < max_;
+	});
+	return count;
+}
+
+//
+void CDStatic_SphereSphereBatch(uint8_t* hits_, const Sphere sphere_, const SphereStream& spheres_)
+{
+	const size_t n = spheres_.Size();
+	switch (SIMDGetLevel())
+	{
+	#if SIMD_X86
+	case SIMDLevel::AVX2: SphereSphereAVX2(hits_, sphere_, spheres_, n); break;
+	case SIMDLevel::SSE: SphereSphereSSE(hits_, sphere_, spheres_, n); break;
+	#endif
+	default: SphereSphereScalar(hits_, sphere_, spheres_, 0, n); break;
+	}
+}
+
+//
+void CDStatic_SphereAABB3Batch(uint8_t* hits_, const Sphere sphere_, const AABB3Stream& boxes_)
+{
+	const size_t n = boxes_.Size();
+	switch (SIMDGetLevel())
+	{
+	#if SIMD_X86
+	case SIMDLevel::AVX2: SphereAABB3AVX2(hits_, sphere_, boxes_, n); break;
+	case SIMDLevel::SSE: SphereAABB3SSE(hits_, sphere_, boxes_, n); break;
+	#endif
+	default: SphereAABB3Scalar(hits_, sphere_, boxes_, 0, n); break;
+	}
+}
+
+//
+void CDStatic_AABB3AABB3Batch(uint8_t* hits_, const AABB3 aabb_, const AABB3Stream& boxes_)
+{
+	const size_t n = boxes_.Size();
+	switch (SIMDGetLevel())
+	{
+	#if SIMD_X86
+	case SIMDLevel::AVX2: AABB3AABB3AVX2(hits_, aabb_, boxes_, n); break;
+	case SIMDLevel::SSE: AABB3AABB3SSE(hits_, aabb_, boxes_, n); break;
+	#endif
+	default: AABB3AABB3Scalar(hits_, aabb_, boxes_, 0, n); break;
+	}
+}
+
+//
+void CDStatic_RaySphereBatch(uint8_t* hits_, float* inter_time_, const Ray3 ray_, const SphereStream& spheres_)
+{
+	if (ray_.dir.LengthSq() <= VEC3_EPSILON * VEC3_EPSILON)
+	{ throw "Division by 0 in CDStatic_RaySphereBatch()"; }
+	CDDynamic_SphereSphereBatch(hits_, inter_time_, { ray_.pt, 0 }, ray_.dir, spheres_);
+}
+
+//
+void CDStatic_RayAABB3Batch(uint8_t* hits_, float* inter_time_, const Ray3 ray_, const AABB3Stream& boxes_)
+{
+	const size_t n = boxes_.Size();
+	const Vec3 inv_dir = SafeInverse(ray_.dir);
+	switch (SIMDGetLevel())
+	{
+	#if SIMD_X86
+	case SIMDLevel::AVX2: RayAABB3AVX2(hits_, inter_time_, ray_.pt, inv_dir, boxes_, n); break;
+	case SIMDLevel::SSE: RayAABB3SSE(hits_, inter_time_, ray_.pt, inv_dir, boxes_, n); break;
+	#endif
+	default: RayAABB3Scalar(hits_, inter_time_, ray_.pt, inv_dir, boxes_, 0, n); break;
+	}
+}
+
+//
+void CDStatic_RayPlaneBatch(uint8_t* hits_, float* inter_time_, const Ray3 ray_, const PlaneStream& planes_)
+{ CDDynamic_SpherePlaneBatch(hits_, inter_time_, { ray_.pt, 0 }, ray_.dir, planes_); }
+
+//
+bool CDDynamic_SphereSphere(const Sphere sphere_0_, const Vec3 sphere_vel_0_, const Sphere sphere_1_, const Vec3 sphere_vel_1_,
+	float& inter_time_)
+{
+	// sphere_1_ stands still and grows by sphere_0_, which shrinks to a ray
+	return RaySphere(sphere_0_.center, sphere_vel_0_ - sphere_vel_1_, sphere_1_.center, sphere_0_.radius + sphere_1_.radius,
+		inter_time_);
+}
+
+//
+bool CDDynamic_SpherePlane(const Sphere sphere_, const Vec3 sphere_vel_, const Plane plane_, float& inter_time_)
+{ return SpherePlane(sphere_.center, sphere_vel_, sphere_.radius, plane_, inter_time_); }
+
+//
+bool CDDynamic_SphereTriangleMesh(const Sphere sphere_, const Vec3 sphere_vel_, const TriangleMesh& mesh_, float& inter_time_,
+	size_t& triangle_)
+{
+	bool hit{ false };
+	TraverseBVHRay(mesh_, sphere_.center, sphere_vel_, sphere_.radius, [&](const uint32_t first_, const size_t count_, float& limit_)
+	{
+		for (size_t i{ first_ }; i < first_ + count_; ++i)
+		{
+			Pt3 a, b, c;
+			float t;
+			mesh_.Triangle(i, a, b, c);
+			if (SweptSphereTriangle(sphere_.center, sphere_vel_, sphere_.radius, a, b, c, t) && (!hit || t < limit_))
+			{
+				limit_ = inter_time_ = t;
+				triangle_ = mesh_.triangle_ids[i];
+				hit = true;
+			}
+		}
+		// nothing comes before already touching
+		return !hit || limit_ > 0;
+	});
+	return hit;
+}
+
+//
+void CDDynamic_SphereSphereBatch(uint8_t* hits_, float* inter_time_, const Sphere sphere_, const Vec3 sphere_vel_,
+	const SphereStream& spheres_)
+{
+	const size_t n = spheres_.Size();
+	const Ray3 ray{ sphere_.center, sphere_vel_ };
+	switch (SIMDGetLevel())
+	{
+	#if SIMD_X86
+	case SIMDLevel::AVX2: RaySphereAVX2(hits_, inter_time_, ray, sphere_.radius, spheres_, n); break;
+	case SIMDLevel::SSE: RaySphereSSE(hits_, inter_time_, ray, sphere_.radius, spheres_, n); break;
+	#endif
+	default: RaySphereScalar(hits_, inter_time_, ray, sphere_.radius, spheres_, 0, n); break;
+	}
+}
+
+//
+void CDDynamic_SpherePlaneBatch(uint8_t* hits_, float* inter_time_, const Sphere sphere_, const Vec3 sphere_vel_,
+	const PlaneStream& planes_)
+{
+	const size_t n = planes_.Size();
+	switch (SIMDGetLevel())
+	{
+	#if SIMD_X86
+	case SIMDLevel::AVX2: SpherePlaneAVX2(hits_, inter_time_, sphere_, sphere_vel_, planes_, n); break;
+	case SIMDLevel::SSE: SpherePlaneSSE(hits_, inter_time_, sphere_, sphere_vel_, planes_, n); break;
+	#endif
+	default: SpherePlaneScalar(hits_, inter_time_, sphere_, sphere_vel_, planes_, 0, n); break;
+	}
+}
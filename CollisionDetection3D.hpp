@@ -0,0 +1,137 @@
+//
+#pragma once
+#ifndef COLLISION_DETECTION3D_HPP_
+#define COLLISION_DETECTION3D_HPP_
+
+#include "GJK3D.hpp"
+#include "Stream3D.hpp"
+#include "TriangleMesh.hpp"
+#include "Types3D.hpp"
+#include <cstdint> // uint8_t
+
+// 3D counterparts of CollisionDetection.hpp. Rays follow the 2D Ray: dir is the whole
+// displacement and inter_time_ is in [0, 1] along it. A ray or a swept sphere that
+// starts inside what it is tested against hits at inter_time_ 0
+
+/* STATIC INTERACTIONS */
+
+// touching does not count, like CDStatic_CircleCircle()
+bool CDStatic_SphereSphere(const Sphere sphere_0_, const Sphere sphere_1_);
+
+// touching counts, like CDStatic_CircleRect()
+bool CDStatic_SphereAABB3(const Sphere sphere_, const AABB3 aabb_);
+
+// touching does not count, like CDStatic_RectRect_AABB()
+bool CDStatic_AABB3AABB3(const AABB3 aabb_0_, const AABB3 aabb_1_);
+
+// throws if ray_.dir is 0
+bool CDStatic_RaySphere(const Ray3 ray_, const Sphere sphere_, float& inter_time_);
+
+// slab test
+bool CDStatic_RayAABB3(const Ray3 ray_, const AABB3 aabb_, float& inter_time_);
+
+// from either side, a ray parallel to plane_ never hits
+bool CDStatic_RayPlane(const Ray3 ray_, const Plane plane_, float& inter_time_);
+
+// 15-axis separating axis test (Ericson 4.4.1) with an early out, boxes that only touch do not overlap
+bool CDStatic_OBB3OBB3(const OBB3& obb_0_, const OBB3& obb_1_);
+
+// axis_cache_ keeps the last separating axis for this pair between frames: obb_0_'s 3 axes,
+// obb_1_'s 3, then the 9 cross products. It is tried first and updated when another axis separates
+bool CDStatic_OBB3OBB3(const OBB3& obb_0_, const OBB3& obb_1_, size_t& axis_cache_);
+
+// touching counts
+bool CDStatic_SphereOBB3(const Sphere sphere_, const OBB3& obb_);
+
+// slab test in the box's frame
+bool CDStatic_RayOBB3(const Ray3 ray_, const OBB3& obb_, float& inter_time_);
+
+// nearest hit from either side of a triangle, triangle_ is its index in the TriangleMesh() arguments
+bool CDStatic_RayTriangleMesh(const Ray3 ray_, const TriangleMesh& mesh_, float& inter_time_, size_t& triangle_);
+
+// stops at the first hit the traversal finds, for line of sight checks
+bool CDStatic_RayTriangleMeshAny(const Ray3 ray_, const TriangleMesh& mesh_);
+
+// touching counts
+bool CDStatic_SphereTriangleMesh(const Sphere sphere_, const TriangleMesh& mesh_);
+
+// writes the indices of up to max_ triangles sphere_ touches to triangles_, in no particular order, returns how many
+size_t CDStatic_SphereTriangleMesh(const Sphere sphere_, const TriangleMesh& mesh_, size_t* triangles_, size_t max_);
+
+// the convex tests below take any two of Sphere, OBB3, Capsule3, ConvexHull3 or another type
+// with a Support() member, see GJK3D.hpp. simplex_ is the pair's from the last frame, empty
+// the first time, and is left holding this frame's
+
+// 0 on overlap or touching, closest_0_ and closest_1_ are the closest points on each shape
+template <typename Shape0, typename Shape1>
+float CDStatic_ConvexDistance(const Shape0& shape_0_, const Shape1& shape_1_, GJKSimplex3D& simplex_, Pt3& closest_0_,
+	Pt3& closest_1_)
+{ return GJK3D(shape_0_, shape_1_, simplex_, closest_0_, closest_1_); }
+
+// touching counts, stops at the first support point that proves separation
+template <typename Shape0, typename Shape1>
+bool CDStatic_ConvexConvex(const Shape0& shape_0_, const Shape1& shape_1_, GJKSimplex3D& simplex_)
+{
+	Pt3 closest_0, closest_1;
+	return GJK3D(shape_0_, shape_1_, simplex_, closest_0, closest_1, true) == 0;
+}
+
+// moving shape_0_ by mtv_ separates the shapes, false if they do not overlap or only touch
+template <typename Shape0, typename Shape1>
+bool CDStatic_ConvexPenetration(const Shape0& shape_0_, const Shape1& shape_1_, GJKSimplex3D& simplex_, Vec3& mtv_)
+{
+	Pt3 closest_0, closest_1;
+	if (GJK3D(shape_0_, shape_1_, simplex_, closest_0, closest_1, true) > 0)
+	{ return false; }
+	return EPA3D(shape_0_, shape_1_, simplex_, mtv_);
+}
+
+/* BATCH STATIC INTERACTIONS */
+// dispatch on SIMDGetLevel(), 8 per AVX2 iteration. bit i % 8 of hits_[i / 8] is set if
+// the first argument hits element i, hits_ holds at least (Size() + 7) / 8 bytes and bits
+// past the end of the last byte are cleared. inter_time_ holds Size() floats and is
+// only meaningful where the bit is set
+
+//
+void CDStatic_SphereSphereBatch(uint8_t* hits_, const Sphere sphere_, const SphereStream& spheres_);
+
+//
+void CDStatic_SphereAABB3Batch(uint8_t* hits_, const Sphere sphere_, const AABB3Stream& boxes_);
+
+//
+void CDStatic_AABB3AABB3Batch(uint8_t* hits_, const AABB3 aabb_, const AABB3Stream& boxes_);
+
+// throws if ray_.dir is 0
+void CDStatic_RaySphereBatch(uint8_t* hits_, float* inter_time_, const Ray3 ray_, const SphereStream& spheres_);
+
+//
+void CDStatic_RayAABB3Batch(uint8_t* hits_, float* inter_time_, const Ray3 ray_, const AABB3Stream& boxes_);
+
+//
+void CDStatic_RayPlaneBatch(uint8_t* hits_, float* inter_time_, const Ray3 ray_, const PlaneStream& planes_);
+
+/* DYNAMIC INTERACTIONS */
+
+// time of impact over one frame, velocities are the displacement over it
+bool CDDynamic_SphereSphere(const Sphere sphere_0_, const Vec3 sphere_vel_0_, const Sphere sphere_1_, const Vec3 sphere_vel_1_,
+	float& inter_time_);
+
+// from either side, a sphere touching plane_ and moving away does not hit
+bool CDDynamic_SpherePlane(const Sphere sphere_, const Vec3 sphere_vel_, const Plane plane_, float& inter_time_);
+
+// earliest contact with any triangle, against its face, an edge or a corner
+bool CDDynamic_SphereTriangleMesh(const Sphere sphere_, const Vec3 sphere_vel_, const TriangleMesh& mesh_, float& inter_time_,
+	size_t& triangle_);
+
+/* BATCH DYNAMIC INTERACTIONS */
+// same layout as the static batches
+
+// spheres_ stay still, pass the relative velocity for moving ones
+void CDDynamic_SphereSphereBatch(uint8_t* hits_, float* inter_time_, const Sphere sphere_, const Vec3 sphere_vel_,
+	const SphereStream& spheres_);
+
+//
+void CDDynamic_SpherePlaneBatch(uint8_t* hits_, float* inter_time_, const Sphere sphere_, const Vec3 sphere_vel_,
+	const PlaneStream& planes_);
+
+#endif // COLLISION_DETECTION3D_HPP_
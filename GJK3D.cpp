@@ -0,0 +1,265 @@
+//
+#include "GJK3D.hpp"
+
+#include <cfloat> // FLT_MAX, DBL_MAX
+#include <utility> // std::swap()
+
+namespace
+{
+	// below this a segment, triangle or tetrahedron is treated as one dimension less
+	constexpr float DEGENERATE = VEC3_EPSILON * VEC3_EPSILON;
+
+	// the sub-simplex solves run in double: the simplices get long and thin near
+	// convergence, where the float barycentric terms cancel to noise and GJK stalls
+	// short of the distance
+	constexpr double DEGENERATE_D = static_cast<double>(DEGENERATE) * DEGENERATE;
+
+	//
+	Vec3d Widen(const GJKVertex3D& vertex_)
+	{ return Vec3d(vertex_.w); }
+
+	//
+	Vec3d SolvePoint(const GJKVertex3D& a_, GJKSimplex3D& out_)
+	{
+		out_.vertices[0] = a_;
+		out_.vertices[0].u = 1;
+		out_.count = 1;
+		return Widen(a_);
+	}
+
+	// writes the sub-simplex of a_ and b_ holding the point closest to the origin into out_
+	Vec3d SolveSegment(const GJKVertex3D& a_, const GJKVertex3D& b_, GJKSimplex3D& out_)
+	{
+		const Vec3d a = Widen(a_), edge = Widen(b_) - a;
+		const double length_sq = edge.LengthSq();
+		const double t = length_sq > DEGENERATE_D ? -VectorDotProduct(a, edge) / length_sq : 0;
+		if (t <= 0)
+		{ return SolvePoint(a_, out_); }
+		if (t >= 1)
+		{ return SolvePoint(b_, out_); }
+		out_.vertices[0] = a_;
+		out_.vertices[1] = b_;
+		out_.vertices[0].u = static_cast<float>(1 - t);
+		out_.vertices[1].u = static_cast<float>(t);
+		out_.count = 2;
+		return a + edge * t;
+	}
+
+	// the closest of the three edges, for triangles too thin to have a face region
+	Vec3d SolveEdges(const GJKVertex3D& a_, const GJKVertex3D& b_, const GJKVertex3D& c_, GJKSimplex3D& out_)
+	{
+		const GJKVertex3D* edges[3][2]{ { &a_, &b_ }, { &b_, &c_ }, { &c_, &a_ } };
+		Vec3d best{ 0, 0, 0 };
+		double best_sq{ DBL_MAX };
+		for (const auto& edge : edges)
+		{
+			GJKSimplex3D candidate;
+			const Vec3d closest = SolveSegment(*edge[0], *edge[1], candidate);
+			if (closest.LengthSq() < best_sq)
+			{ best = closest; best_sq = closest.LengthSq(); out_ = candidate; }
+		}
+		return best;
+	}
+
+	// Voronoi regions of the triangle, Ericson 5.1.5 with the query point at the origin
+	Vec3d SolveTriangle(const GJKVertex3D& a_, const GJKVertex3D& b_, const GJKVertex3D& c_, GJKSimplex3D& out_)
+	{
+		const Vec3d a = Widen(a_), b = Widen(b_), c = Widen(c_);
+		const Vec3d ab = b - a, ac = c - a;
+		if (VectorCrossProduct(ab, ac).LengthSq() <= DEGENERATE_D)
+		{ return SolveEdges(a_, b_, c_, out_); }
+
+		const double d1 = -VectorDotProduct(ab, a), d2 = -VectorDotProduct(ac, a);
+		const double d3 = -VectorDotProduct(ab, b), d4 = -VectorDotProduct(ac, b);
+		const double d5 = -VectorDotProduct(ab, c), d6 = -VectorDotProduct(ac, c);
+		const double vc = d1 * d4 - d3 * d2, vb = d5 * d2 - d1 * d6, va = d3 * d6 - d5 * d4;
+
+		if (d1 <= 0 && d2 <= 0)
+		{ return SolvePoint(a_, out_); }
+		if (d3 >= 0 && d4 <= d3)
+		{ return SolvePoint(b_, out_); }
+		if (d6 >= 0 && d5 <= d6)
+		{ return SolvePoint(c_, out_); }
+		if (vc <= 0 && d1 >= 0 && d3 <= 0)
+		{ return SolveSegment(a_, b_, out_); }
+		if (vb <= 0 && d2 >= 0 && d6 <= 0)
+		{ return SolveSegment(a_, c_, out_); }
+		if (va <= 0 && d4 - d3 >= 0 && d5 - d6 >= 0)
+		{ return SolveSegment(b_, c_, out_); }
+
+		const double inv = 1.0 / (va + vb + vc);
+		out_.vertices[0] = a_;
+		out_.vertices[1] = b_;
+		out_.vertices[2] = c_;
+		out_.vertices[0].u = static_cast<float>(va * inv);
+		out_.vertices[1].u = static_cast<float>(vb * inv);
+		out_.vertices[2].u = static_cast<float>(vc * inv);
+		out_.count = 3;
+		return a * (va * inv) + b * (vb * inv) + c * (vc * inv);
+	}
+
+	// the closest point over the faces the origin lies outside of. None means it is inside,
+	// and the weights are the origin's barycentric coordinates
+	Vec3d SolveTetrahedron(const GJKVertex3D (&v_)[4], GJKSimplex3D& out_)
+	{
+		// face i leaves out vertex i
+		constexpr size_t FACES[4][3]{ { 1, 2, 3 }, { 0, 3, 2 }, { 0, 1, 3 }, { 0, 2, 1 } };
+		const Vec3d v0 = Widen(v_[0]);
+		const double volume = VectorDotProduct(VectorCrossProduct(Widen(v_[1]) - v0, Widen(v_[2]) - v0), Widen(v_[3]) - v0);
+		const bool flat = -DEGENERATE_D <= volume && volume <= DEGENERATE_D;
+
+		Vec3d best{ 0, 0, 0 };
+		double best_sq{ DBL_MAX };
+		double weights[4];
+		bool inside{ true };
+		for (size_t i{ 0 }; i < 4; ++i)
+		{
+			const GJKVertex3D& a = v_[FACES[i][0]], & b = v_[FACES[i][1]], & c = v_[FACES[i][2]];
+			// height of the origin above face i over the height of vertex i
+			const Vec3d wa = Widen(a), normal = VectorCrossProduct(Widen(b) - wa, Widen(c) - wa);
+			weights[i] = flat ? -1 : -VectorDotProduct(normal, wa) / VectorDotProduct(normal, Widen(v_[i]) - wa);
+			if (weights[i] >= 0)
+			{ continue; }
+			inside = false;
+			GJKSimplex3D candidate;
+			const Vec3d closest = SolveTriangle(a, b, c, candidate);
+			if (closest.LengthSq() < best_sq)
+			{ best = closest; best_sq = closest.LengthSq(); out_ = candidate; }
+		}
+		if (!inside)
+		{ return best; }
+
+		out_.count = 4;
+		for (size_t i{ 0 }; i < 4; ++i)
+		{
+			out_.vertices[i] = v_[i];
+			out_.vertices[i].u = static_cast<float>(weights[i]);
+		}
+		return { 0, 0, 0 };
+	}
+
+	//
+	EPAPolytope3D::Face MakeFace(const GJKVertex3D* points_, const size_t a_, const size_t b_, const size_t c_)
+	{
+		EPAPolytope3D::Face face{ a_, b_, c_, { 0, 0, 0 }, FLT_MAX };
+		const Vec3 normal = Vector3DCrossProduct(points_[b_].w - points_[a_].w, points_[c_].w - points_[a_].w);
+		const float length = normal.Length();
+		// a sliver keeps its place in the mesh but is never the closest face
+		if (length > DEGENERATE)
+		{
+			face.normal = normal * (1.0f / length);
+			face.dist = Vector3DDotProduct(face.normal, points_[a_].w);
+		}
+		return face;
+	}
+}
+
+//
+Vec3 GJKSolve3D(GJKSimplex3D& simplex_)
+{
+	const GJKSimplex3D in = simplex_;
+	switch (in.count)
+	{
+	case 1: return Vec3(SolvePoint(in.vertices[0], simplex_));
+	case 2: return Vec3(SolveSegment(in.vertices[0], in.vertices[1], simplex_));
+	case 3: return Vec3(SolveTriangle(in.vertices[0], in.vertices[1], in.vertices[2], simplex_));
+	default: return Vec3(SolveTetrahedron(in.vertices, simplex_));
+	}
+}
+
+//
+bool EPAPolytope3D::Init(const GJKVertex3D (&tetrahedron_)[4])
+{
+	for (size_t i{ 0 }; i < 4; ++i)
+	{ points[i] = tetrahedron_[i]; }
+	const float volume = Vector3DDotProduct(Vector3DCrossProduct(points[1].w - points[0].w, points[2].w - points[0].w),
+		points[3].w - points[0].w);
+	if (-DEGENERATE <= volume && volume <= DEGENERATE)
+	{ return false; }
+	// negative volume makes the faces below point outwards
+	if (volume > 0)
+	{ std::swap(points[1], points[2]); }
+	point_count = 4;
+	faces[0] = MakeFace(points, 0, 1, 2);
+	faces[1] = MakeFace(points, 0, 3, 1);
+	faces[2] = MakeFace(points, 0, 2, 3);
+	faces[3] = MakeFace(points, 1, 3, 2);
+	face_count = 4;
+	return true;
+}
+
+//
+const EPAPolytope3D::Face& EPAPolytope3D::Closest() const
+{
+	size_t best{ 0 };
+	for (size_t i{ 1 }; i < face_count; ++i)
+	{
+		if (faces[i].dist < faces[best].dist)
+		{ best = i; }
+	}
+	return faces[best];
+}
+
+//
+bool EPAPolytope3D::Expand(const GJKVertex3D& vertex_)
+{
+	// each visible face adds its 3 edges, one a neighbouring visible face shares cancels out,
+	// which leaves the horizon. On a closed mesh that is 2 more edges than faces removed
+	constexpr size_t MAX_EDGES = MAX_FACES + 2;
+	size_t edges[MAX_EDGES][2];
+	size_t edge_count{ 0 }, visible_count{ 0 };
+	bool visible[MAX_FACES];
+
+	if (point_count == MAX_POINTS || face_count + 2 > MAX_FACES)
+	{ return false; }
+	// the horizon is found before any face goes, so a vertex that does not fit leaves the polytope closed
+	for (size_t i{ 0 }; i < face_count; ++i)
+	{
+		const Face& face = faces[i];
+		visible[i] = Vector3DDotProduct(face.normal, vertex_.w - points[face.a].w) > 0;
+		if (!visible[i])
+		{ continue; }
+		++visible_count;
+
+		const size_t corners[3]{ face.a, face.b, face.c };
+		for (size_t e{ 0 }; e < 3; ++e)
+		{
+			const size_t from = corners[e], to = corners[(e + 1) % 3];
+			bool shared{ false };
+			for (size_t j{ 0 }; j < edge_count; ++j)
+			{
+				if (edges[j][0] == to && edges[j][1] == from)
+				{
+					edges[j][0] = edges[edge_count - 1][0];
+					edges[j][1] = edges[edge_count - 1][1];
+					--edge_count;
+					shared = true;
+					break;
+				}
+			}
+			if (shared)
+			{ continue; }
+			if (edge_count == MAX_EDGES)
+			{ return false; }
+			edges[edge_count][0] = from;
+			edges[edge_count][1] = to;
+			++edge_count;
+		}
+	}
+	if (face_count - visible_count + edge_count > MAX_FACES)
+	{ return false; }
+
+	size_t kept{ 0 };
+	for (size_t i{ 0 }; i < face_count; ++i)
+	{
+		if (!visible[i])
+		{ faces[kept++] = faces[i]; }
+	}
+	face_count = kept;
+
+	points[point_count] = vertex_;
+	for (size_t i{ 0 }; i < edge_count; ++i)
+	{ faces[face_count++] = MakeFace(points, edges[i][0], edges[i][1], point_count); }
+	++point_count;
+	return true;
+}
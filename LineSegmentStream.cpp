@@ -0,0 +1,135 @@
+//
+#include "LineSegmentStream.hpp"
+#include <cstring> // memcpy(), memset()
+#include <utility> // std::swap()
+#include <vector> // std::vector
+
+//
+LineSegmentStream::LineSegmentStream(const Pt2* pos_, const float* scale_, const float* dir_, const size_t count_)
+{
+	std::vector<Rot2> rot(count_);
+	Rot2RotRadBatch(rot.data(), dir_, count_);
+	Reserve(count_);
+	for (size_t i{ 0 }; i < count_; ++i)
+	{ Set(i, pos_[i], scale_[i], rot[i]); }
+	size = count_;
+}
+
+//
+LineSegmentStream::LineSegmentStream(const LineSegmentStream& rhs_)
+{
+	Reserve(rhs_.size);
+	for (size_t k{ 0 }; k < FIELDS && rhs_.size; ++k)
+	{ memcpy(p0_x + k * capacity, rhs_.p0_x + k * rhs_.capacity, rhs_.size * sizeof(float)); }
+	size = rhs_.size;
+}
+
+//
+LineSegmentStream::LineSegmentStream(LineSegmentStream&& rhs_) noexcept
+{ Swap(rhs_); }
+
+//
+LineSegmentStream::~LineSegmentStream()
+{ SIMDAlignedFree(p0_x); }
+
+//
+LineSegmentStream& LineSegmentStream::operator=(LineSegmentStream rhs_)
+{
+	// copy swap idiom
+	Swap(rhs_);
+	return *this;
+}
+
+//
+void LineSegmentStream::Reserve(const size_t capacity_)
+{
+	if (capacity_ <= capacity)
+	{ return; }
+
+	const size_t padded = SIMDPaddedSize(capacity_);
+	float* block = static_cast<float*>(SIMDAlignedAlloc(FIELDS * padded * sizeof(float)));
+	memset(block, 0, FIELDS * padded * sizeof(float));
+	for (size_t k{ 0 }; k < FIELDS && size; ++k)
+	{ memcpy(block + k * padded, p0_x + k * capacity, size * sizeof(float)); }
+	SIMDAlignedFree(p0_x);
+	Bind(block, padded);
+	capacity = padded;
+}
+
+//
+void LineSegmentStream::PushBack(const Pt2 pos_, const float scale_, const float dir_)
+{ PushBack(Transform2D{ pos_, Rot2RotRad(dir_) }, scale_); }
+
+//
+void LineSegmentStream::PushBack(const Transform2D& xform_, const float scale_)
+{
+	if (size == capacity)
+	{ Reserve(capacity ? capacity * 2 : SIMD_WIDTH); }
+	Set(size, xform_.pos, scale_, xform_.rot);
+	++size;
+}
+
+//
+void LineSegmentStream::PushBack(const LineSegment& segment_)
+{
+	// the rotor is just the unit direction, scale the length
+	const Vec2 vec = segment_.pt1 - segment_.pt0;
+	const float len = vec.Length();
+	if (len <= VEC2_EPSILON)
+	{ throw "Division by 0 in LineSegmentStream::PushBack()"; }
+	PushBack(Transform2D{ (segment_.pt0 + segment_.pt1) * 0.5f, Rot2{ vec.x / len, vec.y / len } }, len);
+}
+
+//
+void LineSegmentStream::Clear()
+{
+	// zero what was in use so the padding stays zero
+	for (size_t k{ 0 }; k < FIELDS && size; ++k)
+	{ memset(p0_x + k * capacity, 0, size * sizeof(float)); }
+	size = 0;
+}
+
+//
+void LineSegmentStream::Swap(LineSegmentStream& rhs_) noexcept
+{
+	std::swap(p0_x, rhs_.p0_x);
+	std::swap(p0_y, rhs_.p0_y);
+	std::swap(dir_x, rhs_.dir_x);
+	std::swap(dir_y, rhs_.dir_y);
+	std::swap(offset, rhs_.offset);
+	std::swap(length, rhs_.length);
+	std::swap(inv_length, rhs_.inv_length);
+	std::swap(size, rhs_.size);
+	std::swap(capacity, rhs_.capacity);
+}
+
+//
+void LineSegmentStream::Bind(float* block_, const size_t padded_)
+{
+	p0_x = block_;
+	p0_y = block_ + padded_;
+	dir_x = block_ + 2 * padded_;
+	dir_y = block_ + 3 * padded_;
+	offset = block_ + 4 * padded_;
+	length = block_ + 5 * padded_;
+	inv_length = block_ + 6 * padded_;
+}
+
+//
+void LineSegmentStream::Set(const size_t i_, const Pt2 pos_, const float scale_, const Rot2 rot_)
+{
+	if (-VEC2_EPSILON <= scale_ && scale_ <= VEC2_EPSILON)
+	{ throw "Division by 0 in LineSegmentStream()"; }
+
+	// same endpoints as LineSegment: pt0 = pos - rot * scale / 2, a negative
+	// scale swaps the ends, so the unit direction is the rotor times its sign
+	const float half = scale_ * 0.5f;
+	const float sign = scale_ < 0 ? -1.0f : 1.0f;
+	p0_x[i_] = pos_.x - rot_.c * half;
+	p0_y[i_] = pos_.y - rot_.s * half;
+	dir_x[i_] = rot_.c * sign;
+	dir_y[i_] = rot_.s * sign;
+	offset[i_] = dir_y[i_] * p0_x[i_] - dir_x[i_] * p0_y[i_];
+	length[i_] = scale_ * sign;
+	inv_length[i_] = 1.0f / length[i_];
+}
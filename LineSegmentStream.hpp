@@ -0,0 +1,101 @@
+//
+#pragma once
+#ifndef LINE_SEGMENT_STREAM_HPP_
+#define LINE_SEGMENT_STREAM_HPP_
+
+#include "SIMD.hpp"
+#include "Transform2D.hpp"
+#include "Types.hpp"
+
+// structure-of-arrays "baked" LineSegment storage for static geometry. Besides
+// the start point it caches what every test would otherwise recompute: the unit
+// direction, the plane offset dot(normal, p0), the length and 1 / length. The
+// normal is {dir_y, -dir_x}, the same one LineSegment stores. Like Vec2Stream
+// all arrays share one SIMD_ALIGNMENT aligned block, zero padded to SIMD_WIDTH.
+struct LineSegmentStream
+{
+	float* p0_x{ nullptr };
+	float* p0_y{ nullptr };
+	float* dir_x{ nullptr };
+	float* dir_y{ nullptr };
+	float* offset{ nullptr };
+	float* length{ nullptr };
+	float* inv_length{ nullptr };
+
+	/* Constructors */
+
+	//
+	LineSegmentStream() = default;
+
+	// same arguments as LineSegment(pos_, scale_, dir_), count_ of each,
+	// the sines and cosines come from one Rot2RotRadBatch() call
+	LineSegmentStream(const Pt2* pos_, const float* scale_, const float* dir_, size_t count_);
+
+	//
+	LineSegmentStream(const LineSegmentStream& rhs_);
+
+	//
+	LineSegmentStream(LineSegmentStream&& rhs_) noexcept;
+
+	//
+	~LineSegmentStream();
+
+	/* Assignment Operators */
+
+	//
+	LineSegmentStream& operator=(LineSegmentStream rhs_);
+
+	/* Others */
+
+	//
+	size_t Size() const
+	{ return size; }
+
+	//
+	size_t Capacity() const
+	{ return capacity; }
+
+	//
+	Pt2 P0(size_t i_) const
+	{ return { p0_x[i_], p0_y[i_] }; }
+
+	//
+	Pt2 P1(size_t i_) const
+	{ return { p0_x[i_] + dir_x[i_] * length[i_], p0_y[i_] + dir_y[i_] * length[i_] }; }
+
+	//
+	Vec2 Normal(size_t i_) const
+	{ return { dir_y[i_], -dir_x[i_] }; }
+
+	//
+	void Reserve(size_t capacity_);
+
+	// one sincos, throws like LineSegment() if scale_ is 0, so does the batch constructor
+	void PushBack(Pt2 pos_, float scale_, float dir_);
+
+	//
+	void PushBack(const Transform2D& xform_, float scale_);
+
+	//
+	void PushBack(const LineSegment& segment_);
+
+	//
+	void Clear();
+
+	//
+	void Swap(LineSegmentStream& rhs_) noexcept;
+
+private:
+	static constexpr size_t FIELDS = 7;
+
+	// points the field pointers into block_, one padded_ long array each
+	void Bind(float* block_, size_t padded_);
+
+	//
+	void Set(size_t i_, Pt2 pos_, float scale_, Rot2 rot_);
+
+	size_t size{ 0 };
+	size_t capacity{ 0 };
+};
+
+#endif // LINE_SEGMENT_STREAM_HPP_
@@ -7,6 +7,7 @@
 #include <cstring> // memset
 
 #include "Collision.hpp"
+#include "CollisionDetection.hpp"
 #include "Matrix3x3.hpp"
 #include "Matrix4x4.hpp"
 
@@ -17,6 +18,7 @@
 #define TEST_VEC3 0
 #define TEST_MTX33 0
 #define TEST_MTX44 0
+#define TEST_CD2D 0
 
 // these functions depend on the given type have the members 'm' and 'm2'
 #if 0
@@ -446,6 +448,22 @@ int Test2D()
 		quit = true;
 	}
 	#endif
+
+	#if TEST_CD2D
+	// Testing CollisionDetection
+	//--------------------------------------------------------------------------
+	printf("Testing CollisionDetection:\n");
+	printf("-----------------------------\n");
+
+	// CDDynamic_OBBOBB, a box 0.00005 short of another creeping 0.00008 into it
+	//--------------------------------------------------------------------------
+	const OBB2D obb0(Pt2(0.0f, 0.0f), Vec2(1.0f, 1.0f), 0.0f);
+	const OBB2D obb1(Pt2(2.00005f, 0.0f), Vec2(1.0f, 1.0f), 0.0f);
+	float inter_time = 0.0f;
+	const bool slow_hit = CDDynamic_OBBOBB(obb0, Vec2(0.0f, 0.0f), obb1, Vec2(-0.00008f, 0.0f), inter_time);
+	printf("CDDynamicOBBOBB slow: \t%s\n",
+		(slow_hit && fabsf(inter_time - 0.625f) < 0.01f) ? "Pass" : "Fail");
+	#endif
 	return 1;
 }
 
@@ -826,6 +844,106 @@ int Test3D()
 
 #endif
 
+// microbenchmarks for the collision hot paths, flip to 1 to run instead of PhysX
+#define BENCH_CD 0
+#if BENCH_CD
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "CollisionDetection.hpp"
+
+#if defined(_MSC_VER)
+#define BENCH_NOINLINE __declspec(noinline)
+#else
+#define BENCH_NOINLINE __attribute__((noinline))
+#endif
+
+static const size_t BENCH_PAIRS = 1000000;
+
+// stand-ins for the old out-of-line Vector2D.cpp calls, so one run shows before and after
+namespace OutOfLine
+{
+	BENCH_NOINLINE Vec2 Sub(const Vec2& lhs_, const Vec2& rhs_)
+	{ return lhs_ - rhs_; }
+
+	BENCH_NOINLINE Vec2 Add(const Vec2& lhs_, const Vec2& rhs_)
+	{ return lhs_ + rhs_; }
+
+	BENCH_NOINLINE float Dot(const Vec2& vec_0_, const Vec2& vec_1_)
+	{ return Vector2DDotProduct(vec_0_, vec_1_); }
+
+	//
+	bool CircleCircle(const Circle circle_0_, const Circle circle_1_)
+	{
+		const float combined_radius_sq = (circle_0_.radius + circle_1_.radius) * (circle_0_.radius + circle_1_.radius);
+		const float dist_sq = Dot(Sub(circle_0_.center, circle_1_.center), Sub(circle_0_.center, circle_1_.center));
+		return combined_radius_sq > dist_sq;
+	}
+
+	//
+	bool CircleRect(const Circle circle_, const Rect rect_)
+	{
+		const Vec2 half{ rect_.width / 2, rect_.height / 2 };
+		const Pt2 min = Sub(rect_.center, half), max = Add(rect_.center, half);
+		Pt2 test = circle_.center;
+
+		if (circle_.center.x < min.x)
+			test.x = min.x;
+		else if (circle_.center.x > max.x)
+			test.x = max.x;
+
+		if (circle_.center.y < min.y)
+			test.y = min.y;
+		else if (circle_.center.y > max.y)
+			test.y = max.y;
+
+		return Dot(Sub(circle_.center, test), Sub(circle_.center, test)) <= circle_.radius * circle_.radius;
+	}
+}
+
+//
+template <typename Fn>
+void BenchRun(char const* label, Fn fn)
+{
+	const auto start = std::chrono::high_resolution_clock::now();
+	size_t hits = 0;
+	for (size_t i{ 0 }; i < BENCH_PAIRS; ++i)
+	{ hits += fn(i) ? 1 : 0; }
+	const auto end = std::chrono::high_resolution_clock::now();
+	const double ms = std::chrono::duration<double, std::milli>(end - start).count();
+	printf("%-32s %8.3f ms  %6.2f ns/pair  (%zu hits)\n", label, ms, ms * 1.0e6 / BENCH_PAIRS, hits);
+}
+
+//
+int BenchCollisionDetection()
+{
+	std::mt19937 rng{ 1234 };
+	std::uniform_real_distribution<float> pos{ -100.0f, 100.0f }, size{ 1.0f, 10.0f };
+
+	std::vector<Circle> circles_0(BENCH_PAIRS), circles_1(BENCH_PAIRS);
+	std::vector<Rect> rects;
+	rects.reserve(BENCH_PAIRS);
+	for (size_t i{ 0 }; i < BENCH_PAIRS; ++i)
+	{
+		circles_0[i].center = { pos(rng), pos(rng) }; circles_0[i].radius = size(rng);
+		circles_1[i].center = { pos(rng), pos(rng) }; circles_1[i].radius = size(rng);
+		const Pt2 center{ pos(rng), pos(rng) };
+		rects.emplace_back(center, size(rng) * 2, size(rng) * 2);
+	}
+
+	printf("%zu pairs each\n", BENCH_PAIRS);
+	BenchRun("CircleCircle (out-of-line vec)", [&](size_t i) { return OutOfLine::CircleCircle(circles_0[i], circles_1[i]); });
+	BenchRun("CDStatic_CircleCircle", [&](size_t i) { return CDStatic_CircleCircle(circles_0[i], circles_1[i]); });
+	BenchRun("CircleRect (out-of-line vec)", [&](size_t i) { return OutOfLine::CircleRect(circles_0[i], rects[i]); });
+	BenchRun("CDStatic_CircleRect", [&](size_t i) { return CDStatic_CircleRect(circles_0[i], rects[i]); });
+	return 0;
+}
+
+#endif
+
 #include "PxPhysicsAPI.h" // the beeeg include file containing all other physx includes
 // #include <cstdio>
 using namespace physx;
@@ -861,6 +979,10 @@ void createStack(const PxTransform& t, PxU32 size, PxReal halfExtent)
 //
 int main()
 {
+	#if BENCH_CD
+	return BenchCollisionDetection();
+	#endif
+
 	#if OLD
 	float input[] =
 	{
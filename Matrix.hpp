@@ -0,0 +1,222 @@
+//
+#pragma once
+#ifndef MATRIX_H_
+#define MATRIX_H_
+
+#include "Vector.hpp"
+
+// storage only, so Matrix<T, N> can name its elements a00 ... where it makes sense.
+// The constructors write m2 and the generic code only reads m2, so the operators
+// stay usable in constant expressions; a00 ... and m alias it at run time.
+template <typename T, size_t N>
+struct MatrixData
+{
+	union
+	{
+		T m[N * N];
+		T m2[N][N];
+	};
+
+	constexpr MatrixData() : m2{}
+	{ /* empty by design */ }
+
+	// row major, one argument per element
+	template <typename... Ts>
+	constexpr MatrixData(Ts... ts_) : m2{ static_cast<T>(ts_)... }
+	{ static_assert(sizeof...(Ts) == N * N, "wrong number of elements"); }
+};
+
+//
+template <typename T>
+struct MatrixData<T, 3>
+{
+	// some warning about a nameless struct
+	// but it's way more convenient this way :(
+	union
+	{
+		struct
+		{
+			T a00, a01, a02;
+			T a10, a11, a12;
+			T a20, a21, a22;
+		};
+
+		T m[9];
+		T m2[3][3];
+	};
+
+	constexpr MatrixData() : m2{}
+	{ /* empty by design */ }
+
+	constexpr MatrixData(T a00_, T a01_, T a02_,
+		T a10_, T a11_, T a12_,
+		T a20_, T a21_, T a22_) :
+	m2{ { a00_, a01_, a02_ }, { a10_, a11_, a12_ }, { a20_, a21_, a22_ } }
+	{ /* empty by design */ }
+};
+
+//
+template <typename T>
+struct MatrixData<T, 4>
+{
+	union
+	{
+		struct
+		{
+			T a00, a01, a02, a03;
+			T a10, a11, a12, a13;
+			T a20, a21, a22, a23;
+			T a30, a31, a32, a33;
+		};
+
+		T m[16];
+		T m2[4][4];
+	};
+
+	constexpr MatrixData() : m2{}
+	{ /* empty by design */ }
+
+	constexpr MatrixData(T a00_, T a01_, T a02_, T a03_,
+		T a10_, T a11_, T a12_, T a13_,
+		T a20_, T a21_, T a22_, T a23_,
+		T a30_, T a31_, T a32_, T a33_) :
+	m2{ { a00_, a01_, a02_, a03_ }, { a10_, a11_, a12_, a13_ }, { a20_, a21_, a22_, a23_ }, { a30_, a31_, a32_, a33_ } }
+	{ /* empty by design */ }
+};
+
+template <typename T, size_t N>
+struct Matrix;
+
+// result.m[k] = fn_(k / N, k % N) for every element, expanded at compile time
+template <typename T, size_t N, typename Fn, size_t... Ks>
+constexpr Matrix<T, N> MatrixGenerate(Fn fn_, std::index_sequence<Ks...>)
+{ return Matrix<T, N>(fn_(Ks / N, Ks % N)...); }
+
+//
+template <typename T, size_t N, typename Fn>
+constexpr Matrix<T, N> MatrixGenerate(Fn fn_)
+{ return MatrixGenerate<T, N>(fn_, std::make_index_sequence<N * N>{}); }
+
+// sum over l of lhs_[i_][l] * rhs_[l][j_]
+template <typename T, size_t N, size_t... Ls>
+constexpr T MatrixRowColumn(const Matrix<T, N>& lhs_, const Matrix<T, N>& rhs_, const size_t i_, const size_t j_,
+	std::index_sequence<Ls...>)
+{ return ((lhs_.m2[i_][Ls] * rhs_.m2[Ls][j_]) + ...); }
+
+// sum over l of mtx_[i_][l] * vec_[l], vec_ may be shorter than a row
+template <typename T, size_t N, size_t M, size_t... Ls>
+constexpr T MatrixRowDot(const Matrix<T, N>& mtx_, const size_t i_, const Vector<T, M>& vec_, std::index_sequence<Ls...>)
+{ return ((mtx_.m2[i_][Ls] * vec_.Get(VectorIndex<Ls>{})) + ...); }
+
+// N x N row-major matrix of T acting on column vectors. Like Vector, every
+// loop over the elements is expanded at compile time.
+template <typename T, size_t N>
+struct Matrix : MatrixData<T, N>
+{
+	/* Constructors */
+
+	// all zeros
+	constexpr Matrix() = default;
+
+	// one argument per element, row major
+	using MatrixData<T, N>::MatrixData;
+
+	//
+	explicit Matrix(const T* pArr_) :
+	Matrix(MatrixGenerate<T, N>([pArr_](size_t i_, size_t j_) { return pArr_[i_ * N + j_]; }))
+	{ /* empty by design */ }
+
+	// between precisions
+	template <typename U>
+	constexpr explicit Matrix(const Matrix<U, N>& rhs_) :
+	Matrix(MatrixGenerate<T, N>([&](size_t i_, size_t j_) { return static_cast<T>(rhs_.m2[i_][j_]); }))
+	{ /* empty by design */ }
+
+	/* Assignment operators */
+
+	// defaulted so the type stays trivially copyable
+	Matrix& operator=(const Matrix& rhs_) = default;
+
+	//
+	constexpr Matrix& operator+=(const Matrix& rhs_)
+	{ return *this = *this + rhs_; }
+
+	//
+	constexpr Matrix& operator-=(const Matrix& rhs_)
+	{ return *this = *this - rhs_; }
+
+	//
+	constexpr Matrix& operator*=(const Matrix& rhs_)
+	{ return *this = *this * rhs_; }
+
+	/* Others */
+
+	// MatrixDeterminant(), which has a hand-written SSE overload for Matrix4x4
+	constexpr T Determinant() const
+	{ return MatrixDeterminant(*this); }
+
+	//
+	void Swap(Matrix& rhs_)
+	{ std::swap(this->m, rhs_.m); }
+};
+
+//
+template <typename T, size_t N>
+constexpr Matrix<T, N> operator+(const Matrix<T, N>& lhs_, const Matrix<T, N>& rhs_)
+{ return MatrixGenerate<T, N>([&](size_t i_, size_t j_) { return lhs_.m2[i_][j_] + rhs_.m2[i_][j_]; }); }
+
+//
+template <typename T, size_t N>
+constexpr Matrix<T, N> operator-(const Matrix<T, N>& lhs_, const Matrix<T, N>& rhs_)
+{ return MatrixGenerate<T, N>([&](size_t i_, size_t j_) { return lhs_.m2[i_][j_] - rhs_.m2[i_][j_]; }); }
+
+// templates rather than friends so a non-template overload (the SSE Matrix4x4 one) wins
+template <typename T, size_t N>
+constexpr Matrix<T, N> operator*(const Matrix<T, N>& lhs_, const Matrix<T, N>& rhs_)
+{
+	return MatrixGenerate<T, N>([&](size_t i_, size_t j_)
+	{ return MatrixRowColumn(lhs_, rhs_, i_, j_, std::make_index_sequence<N>{}); });
+}
+
+// homogeneous point transform: upper-left (N - 1) x (N - 1) part plus translation
+template <typename T, size_t N>
+constexpr Vector<T, N - 1> operator*(const Matrix<T, N>& mtx_, const Vector<T, N - 1>& rhs_)
+{
+	return VectorGenerate<T, N - 1>([&](auto i_)
+	{ return MatrixRowDot(mtx_, i_, rhs_, std::make_index_sequence<N - 1>{}) + mtx_.m2[i_][N - 1]; });
+}
+
+//
+template <typename T, size_t N>
+constexpr T MatrixDeterminant(const Matrix<T, N>& mtx_)
+{
+	const auto& a = mtx_.m2;
+	if constexpr (N == 2)
+	{ return a[0][0] * a[1][1] - a[0][1] * a[1][0]; }
+	else if constexpr (N == 3)
+	{
+		return a[0][0] * (a[1][1] * a[2][2] - a[1][2] * a[2][1]) -
+			a[0][1] * (a[1][0] * a[2][2] - a[1][2] * a[2][0]) +
+			a[0][2] * (a[1][0] * a[2][1] - a[1][1] * a[2][0]);
+	}
+	else
+	{
+		static_assert(N == 4, "MatrixDeterminant() only goes up to 4x4");
+		// Laplace expansion along row pairs (0, 1) and (2, 3)
+		const auto sub = [&a](size_t p_, size_t i_, size_t j_) { return a[p_][i_] * a[p_ + 1][j_] - a[p_][j_] * a[p_ + 1][i_]; };
+		return sub(0, 0, 1) * sub(2, 2, 3) - sub(0, 0, 2) * sub(2, 1, 3) + sub(0, 0, 3) * sub(2, 1, 2) +
+			sub(0, 1, 2) * sub(2, 0, 3) - sub(0, 1, 3) * sub(2, 0, 2) + sub(0, 2, 3) * sub(2, 0, 1);
+	}
+}
+
+//
+template <typename T, size_t N>
+constexpr Matrix<T, N> MatrixIdentity()
+{ return MatrixGenerate<T, N>([](size_t i_, size_t j_) { return i_ == j_ ? static_cast<T>(1) : static_cast<T>(0); }); }
+
+//
+template <typename T, size_t N>
+constexpr Matrix<T, N> MatrixTranspose(const Matrix<T, N>& mtx_)
+{ return MatrixGenerate<T, N>([&](size_t i_, size_t j_) { return mtx_.m2[j_][i_]; }); }
+
+#endif // MATRIX_H_
@@ -1,7 +1,10 @@
 //
 #include "Matrix3x3.hpp"
-#include <algorithm> // std::swap()
+#include "Vec2Stream.hpp"
+#include <algorithm> // std::max()
 #include <corecrt_math_defines.h> // M_PI
+#include <thread> // std::thread
+#include <vector> // std::vector
 
 constexpr float EPSILON = 0.0001f;
 static const size_t _sz = 3; // # of dimensions of matrix
@@ -9,127 +12,196 @@ static const size_t _sz = 3; // # of dimensions of matrix
 const Vector2D e1_2D{ 1, 0 };
 const Vector2D e2_2D{ 0, 1 };
 
-//
-Matrix3x3::Matrix3x3(const float* pArr_)
+namespace
 {
-	for (size_t i{ 0 }; i < _sz * _sz; ++i)
-	{ m[i] = *(pArr_ + i); }
-}
+	size_t parallelThreshold = 1 << 16;
 
-//
-Matrix3x3::Matrix3x3(const float a00_, const float a01_, const float a02_,
-	const float a10_, const float a11_, const float a12_,
-	const float a20_, const float a21_, const float a22_)
-{
-	a00 = a00_; a01 = a01_; a02 = a02_;
-	a10 = a10_; a11 = a11_; a12 = a12_;
-	a20 = a20_; a21 = a21_; a22 = a22_;
-}
+	// runs fn_(begin, end) over [0, count_), split across threads past the threshold
+	template <typename Fn>
+	void ParallelFor(const size_t count_, Fn fn_)
+	{
+		const size_t threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+		if (count_ < parallelThreshold || threads == 1)
+		{
+			fn_(size_t{ 0 }, count_);
+			return;
+		}
 
-//
-Matrix3x3& Matrix3x3::operator=(const Matrix3x3& rhs_)
-{
-	// copy swap idiom
-	Matrix3x3 temp{ rhs_ };
-	Swap(temp);
-	return *this;
-}
+		// chunks stay a multiple of SIMD_WIDTH so only the last one has a scalar tail
+		const size_t chunk = SIMDPaddedSize((count_ + threads - 1) / threads);
+		std::vector<std::thread> workers;
+		size_t begin = 0;
+		for (; begin + chunk < count_; begin += chunk)
+		{ workers.emplace_back(fn_, begin, begin + chunk); }
+		fn_(begin, count_);
+		for (std::thread& worker : workers)
+		{ worker.join(); }
+	}
 
-//
-Matrix3x3& Matrix3x3::operator+=(const Matrix3x3& rhs_)
-{ return *this = *this + rhs_; }
+	// translation_ is 1 for points and 0 for directions
+	void TransformScalar(Vector2D* result_, const Matrix3x3& mtx_, const Vector2D* in_,
+		const float translation_, size_t begin_, const size_t end_)
+	{
+		for (; begin_ < end_; ++begin_)
+		{
+			const Vector2D v = in_[begin_];
+			result_[begin_] =
+			{
+				mtx_.a00 * v.x + mtx_.a01 * v.y + mtx_.a02 * translation_,
+				mtx_.a10 * v.x + mtx_.a11 * v.y + mtx_.a12 * translation_
+			};
+		}
+	}
 
-//
-Matrix3x3& Matrix3x3::operator-=(const Matrix3x3 & rhs_)
-{ return *this = *this - rhs_; }
+	//
+	void TransformStreamScalar(float* rx_, float* ry_, const Matrix3x3& mtx_, const float* x_, const float* y_,
+		const float translation_, size_t begin_, const size_t end_)
+	{
+		for (; begin_ < end_; ++begin_)
+		{
+			const float x = x_[begin_], y = y_[begin_];
+			rx_[begin_] = mtx_.a00 * x + mtx_.a01 * y + mtx_.a02 * translation_;
+			ry_[begin_] = mtx_.a10 * x + mtx_.a11 * y + mtx_.a12 * translation_;
+		}
+	}
 
-//
-Matrix3x3& Matrix3x3::operator*=(const Matrix3x3& rhs_)
-{ return *this = *this * rhs_; }
+	#if SIMD_X86
+	// two interleaved points per register: {x0 x0 x1 x1} * {a00 a10 a00 a10} + {y0 y0 y1 y1} * {a01 a11 a01 a11} + t
+	SIMD_TARGET_SSE void TransformSSE(Vector2D* result_, const Matrix3x3& mtx_, const Vector2D* in_,
+		const float translation_, const size_t begin_, const size_t end_)
+	{
+		const __m128 cx = _mm_setr_ps(mtx_.a00, mtx_.a10, mtx_.a00, mtx_.a10);
+		const __m128 cy = _mm_setr_ps(mtx_.a01, mtx_.a11, mtx_.a01, mtx_.a11);
+		const __m128 t = _mm_mul_ps(_mm_setr_ps(mtx_.a02, mtx_.a12, mtx_.a02, mtx_.a12), _mm_set1_ps(translation_));
+		size_t i{ begin_ };
+		for (; i + 2 <= end_; i += 2)
+		{
+			const __m128 p = _mm_loadu_ps(in_[i].m);
+			const __m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_moveldup_ps(p), cx), _mm_mul_ps(_mm_movehdup_ps(p), cy)), t);
+			_mm_storeu_ps(result_[i].m, r);
+		}
+		TransformScalar(result_, mtx_, in_, translation_, i, end_);
+	}
 
-//
-float Matrix3x3::Determinant() const
-{
-	float result{ 0.0f };
-	for (size_t i = 0; i < _sz; ++i)
+	// same as TransformSSE() with four points per register
+	SIMD_TARGET_AVX2 void TransformAVX2(Vector2D* result_, const Matrix3x3& mtx_, const Vector2D* in_,
+		const float translation_, const size_t begin_, const size_t end_)
 	{
-		// this took a while...
-		float det_2x2 = m[1 * _sz + (i + 1) % _sz] *		// a of 2x2
-			m[2 * _sz + (i + 2) % _sz] - // d of 2x2
-			m[1 * _sz + (i + 2) % _sz] *		// b of 2x2
-			m[2 * _sz + (i + 1) % _sz];	// c of 2x2
-		result += m[i] * det_2x2;
-		// ends up being correct because the minus signs are accounted for
+		const __m256 cx = _mm256_setr_ps(mtx_.a00, mtx_.a10, mtx_.a00, mtx_.a10, mtx_.a00, mtx_.a10, mtx_.a00, mtx_.a10);
+		const __m256 cy = _mm256_setr_ps(mtx_.a01, mtx_.a11, mtx_.a01, mtx_.a11, mtx_.a01, mtx_.a11, mtx_.a01, mtx_.a11);
+		const __m256 t = _mm256_mul_ps(_mm256_setr_ps(mtx_.a02, mtx_.a12, mtx_.a02, mtx_.a12, mtx_.a02, mtx_.a12, mtx_.a02, mtx_.a12),
+			_mm256_set1_ps(translation_));
+		static_assert(sizeof(Vector2D) == 2 * sizeof(float), "Vector2D must be tightly packed");
+		size_t i{ begin_ };
+		for (; i + 4 <= end_; i += 4)
+		{
+			const __m256 p = _mm256_loadu_ps(in_[i].m);
+			_mm256_storeu_ps(result_[i].m, _mm256_fmadd_ps(_mm256_movehdup_ps(p), cy, _mm256_fmadd_ps(_mm256_moveldup_ps(p), cx, t)));
+		}
+		TransformScalar(result_, mtx_, in_, translation_, i, end_);
 	}
-	return  result;
-}
 
-//
-void Matrix3x3::Swap(Matrix3x3& rhs_)
-{ std::swap((*this).m, rhs_.m); }
+	//
+	SIMD_TARGET_SSE void TransformStreamSSE(float* rx_, float* ry_, const Matrix3x3& mtx_, const float* x_, const float* y_,
+		const float translation_, const size_t begin_, const size_t end_)
+	{
+		const __m128 a00 = _mm_set1_ps(mtx_.a00), a01 = _mm_set1_ps(mtx_.a01), a02 = _mm_set1_ps(mtx_.a02 * translation_);
+		const __m128 a10 = _mm_set1_ps(mtx_.a10), a11 = _mm_set1_ps(mtx_.a11), a12 = _mm_set1_ps(mtx_.a12 * translation_);
+		size_t i{ begin_ };
+		for (; i + 4 <= end_; i += 4)
+		{
+			const __m128 x = _mm_loadu_ps(x_ + i), y = _mm_loadu_ps(y_ + i);
+			_mm_storeu_ps(rx_ + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(a00, x), _mm_mul_ps(a01, y)), a02));
+			_mm_storeu_ps(ry_ + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(a10, x), _mm_mul_ps(a11, y)), a12));
+		}
+		TransformStreamScalar(rx_, ry_, mtx_, x_, y_, translation_, i, end_);
+	}
 
-//
-Matrix3x3 operator+(const Matrix3x3& lhs_, const Matrix3x3& rhs_)
-{
-	Matrix3x3 result{ lhs_ };
-	for (size_t i{0}; i < _sz *_sz; ++i)
-	{ result.m[i] += rhs_.m[i]; }
-	return result;
+	//
+	SIMD_TARGET_AVX2 void TransformStreamAVX2(float* rx_, float* ry_, const Matrix3x3& mtx_, const float* x_, const float* y_,
+		const float translation_, const size_t begin_, const size_t end_)
+	{
+		const __m256 a00 = _mm256_set1_ps(mtx_.a00), a01 = _mm256_set1_ps(mtx_.a01), a02 = _mm256_set1_ps(mtx_.a02 * translation_);
+		const __m256 a10 = _mm256_set1_ps(mtx_.a10), a11 = _mm256_set1_ps(mtx_.a11), a12 = _mm256_set1_ps(mtx_.a12 * translation_);
+		size_t i{ begin_ };
+		for (; i + 8 <= end_; i += 8)
+		{
+			const __m256 x = _mm256_loadu_ps(x_ + i), y = _mm256_loadu_ps(y_ + i);
+			_mm256_storeu_ps(rx_ + i, _mm256_fmadd_ps(a01, y, _mm256_fmadd_ps(a00, x, a02)));
+			_mm256_storeu_ps(ry_ + i, _mm256_fmadd_ps(a11, y, _mm256_fmadd_ps(a10, x, a12)));
+		}
+		TransformStreamScalar(rx_, ry_, mtx_, x_, y_, translation_, i, end_);
+	}
+	#endif
+
+	//
+	void Transform(Vector2D* result_, const Matrix3x3& mtx_, const Vector2D* in_, const float translation_, const size_t count_)
+	{
+		const SIMDLevel level = SIMDGetLevel();
+		ParallelFor(count_, [=, &mtx_](const size_t begin_, const size_t end_)
+		{
+			switch (level)
+			{
+			#if SIMD_X86
+			case SIMDLevel::AVX2: TransformAVX2(result_, mtx_, in_, translation_, begin_, end_); break;
+			case SIMDLevel::SSE: TransformSSE(result_, mtx_, in_, translation_, begin_, end_); break;
+			#endif
+			default: TransformScalar(result_, mtx_, in_, translation_, begin_, end_); break;
+			}
+		});
+	}
+
+	//
+	void TransformStream(Vec2Stream& result_, const Matrix3x3& mtx_, const Vec2Stream& in_, const float translation_)
+	{
+		const size_t count = in_.Size();
+		result_.Resize(count);
+		float* rx = result_.x;
+		float* ry = result_.y;
+		const float* x = in_.x;
+		const float* y = in_.y;
+		const SIMDLevel level = SIMDGetLevel();
+		ParallelFor(count, [=, &mtx_](const size_t begin_, const size_t end_)
+		{
+			switch (level)
+			{
+			#if SIMD_X86
+			case SIMDLevel::AVX2: TransformStreamAVX2(rx, ry, mtx_, x, y, translation_, begin_, end_); break;
+			case SIMDLevel::SSE: TransformStreamSSE(rx, ry, mtx_, x, y, translation_, begin_, end_); break;
+			#endif
+			default: TransformStreamScalar(rx, ry, mtx_, x, y, translation_, begin_, end_); break;
+			}
+		});
+	}
 }
 
 //
-Matrix3x3 operator-(const Matrix3x3& lhs_, const Matrix3x3& rhs_)
-{
-	Matrix3x3 result{ lhs_ };
-	for (size_t i{ 0 }; i < _sz * _sz; ++i)
-	{ result.m[i] -= rhs_.m[i]; }
-	return result;
-}
+void Mtx33SetParallelThreshold(const size_t count_)
+{ parallelThreshold = count_; }
 
 //
-Matrix3x3 operator*(const Matrix3x3& lhs_, const Matrix3x3& rhs_)
-{
-	float zeros[_sz * _sz] = { 0 };
-	Matrix3x3 result(zeros);
+size_t Mtx33GetParallelThreshold()
+{ return parallelThreshold; }
 
-	for (size_t i = 0; i < _sz * _sz; ++i)
-	{
-		for (size_t j = 0; j < _sz; ++j)
-		{ result.m[i] += lhs_.m[(i / _sz) * _sz + j] * rhs_.m[j * _sz + i % _sz]; }
-	}
-	return result;
-}
+//
+void Mtx33TransformPoints(Vector2D* result_, const Matrix3x3& mtx_, const Vector2D* points_, const size_t count_)
+{ Transform(result_, mtx_, points_, 1.0f, count_); }
 
 //
-Vector2D operator*(const Matrix3x3& pMtx_, const Vector2D& rhs_)
-{
-	const size_t n = 2; // # of dimensions of vector
-	Vector2D result(0, 0);
+void Mtx33TransformVectors(Vector2D* result_, const Matrix3x3& mtx_, const Vector2D* vectors_, const size_t count_)
+{ Transform(result_, mtx_, vectors_, 0.0f, count_); }
 
-	// applying effect of upper-left 2x2 submatrix of pMtx_
-	for (size_t i = 0; i < n; ++i)
-	{
-		for (size_t j = 0; j < n; ++j)
-		{ result.m[i] += pMtx_.m[i * _sz + j] * rhs_.m[j]; }
-	}
+//
+void Mtx33TransformPoints(Vec2Stream& result_, const Matrix3x3& mtx_, const Vec2Stream& points_)
+{ TransformStream(result_, mtx_, points_, 1.0f); }
 
-	// translation
-	for (size_t i = 0; i < n; ++i)
-	{ result.m[i] += pMtx_.m[i * _sz + (_sz - 1)]; }
-	return result;
-}
+//
+void Mtx33TransformVectors(Vec2Stream& result_, const Matrix3x3& mtx_, const Vec2Stream& vectors_)
+{ TransformStream(result_, mtx_, vectors_, 0.0f); }
 
 //
 Matrix3x3 Mtx33Identity()
-{
-	Matrix3x3 result;
-	for (size_t i = 0; i < _sz; ++i)
-	{
-		for (size_t j = 0; j < _sz; ++j)
-		{ result.m[i * _sz + j] = (i == j) ? 1.0f : 0.0f; }
-	}
-	return result;
-}
+{ return MatrixIdentity<float, 3>(); }
 
 //
 Matrix3x3 Mtx33Translate(const float x_, const float y_)
@@ -197,16 +269,7 @@ Matrix3x3 Mtx33Proj(const Vector2D& axis_)
 
 //
 Matrix3x3 Mtx33Transpose(const Matrix3x3& mtx_)
-{
-	Matrix3x3 result;
-	for (size_t i = 0; i < _sz; ++i)
-	{
-		for (size_t j = 0; j < _sz; ++j)
-		{ result.m[i * _sz + j] = mtx_.m[j * _sz + i]; }
-		// swapped the i and j for mtx
-	}
-	return result;
-}
+{ return MatrixTranspose(mtx_); }
 
 //
 Matrix3x3 Mtx33Inverse(Matrix3x3* result_, float* determinant_, const Matrix3x3& mtx_)
@@ -3,74 +3,39 @@
 #ifndef MATRIX3X3_H_
 #define MATRIX3X3_H_
 
+#include "Matrix.hpp"
 #include "Vector2D.hpp"
 
+struct Vec2Stream; // just a forward declaration
+
 extern const Vector2D e1_2D; // {1, 0}
 extern const Vector2D e2_2D; // {0, 1}
 
-//
-typedef union Matrix3x3
-{
-	// some warning about a nameless struct
-	// but it's way more convenient this way :(
-	struct
-	{
-		float a00, a01, a02;
-		float a10, a11, a12;
-		float a20, a21, a22;
-	};
-
-	float m[9]{};
-	float m2[3][3];
-
-	/* Constructors */
-
-	//
-	Matrix3x3() = default;
-
-	//
-	explicit Matrix3x3(const float* pArr_);
-
-	//
-	Matrix3x3(float a00_, float a01_, float a02_,
-		float a10_, float a11_, float a12_,
-		float a20_, float a21_, float a22_);
-
-	/* Assignment operators */
-
-	//
-	Matrix3x3& operator=(const Matrix3x3& rhs_);
+// a00 ... a22 view of Matrix<float, 3>, see Matrix.hpp for the members and operators
+using Matrix3x3 = Matrix<float, 3>;
+using Mtx33 = Matrix3x3;
 
-	//
-	Matrix3x3& operator+=(const Matrix3x3& rhs_);
+// double precision for large-world coordinates
+using Matrix3x3d = Matrix<double, 3>;
+using Mtx33d = Matrix3x3d;
 
-	//
-	Matrix3x3& operator-=(const Matrix3x3& rhs_);
-
-	//
-	Matrix3x3& operator*=(const Matrix3x3& rhs_);
-
-	/* Others */
-
-	//
-	float Determinant() const;
-
-	//
-	void Swap(Matrix3x3& rhs_);
-
-} Matrix3x3, Mtx33;
+// batches at least this big are split across std::thread::hardware_concurrency() threads
+void Mtx33SetParallelThreshold(size_t count_);
 
 //
-Matrix3x3 operator+(const Matrix3x3& lhs_, const Matrix3x3& rhs_);
+size_t Mtx33GetParallelThreshold();
 
-//
-Matrix3x3 operator-(const Matrix3x3& lhs_, const Matrix3x3& rhs_);
+// transforms count_ points (translation applied), result_ may alias points_
+void Mtx33TransformPoints(Vector2D* result_, const Matrix3x3& mtx_, const Vector2D* points_, size_t count_);
 
-//
-Matrix3x3 operator*(const Matrix3x3& lhs_, const Matrix3x3& rhs_);
+// transforms count_ directions (translation ignored), result_ may alias vectors_
+void Mtx33TransformVectors(Vector2D* result_, const Matrix3x3& mtx_, const Vector2D* vectors_, size_t count_);
 
-//
-Vector2D operator*(const Matrix3x3& pMtx_, const Vector2D& rhs_);
+// SoA version of the above
+void Mtx33TransformPoints(Vec2Stream& result_, const Matrix3x3& mtx_, const Vec2Stream& points_);
+
+// SoA version of the above
+void Mtx33TransformVectors(Vec2Stream& result_, const Matrix3x3& mtx_, const Vec2Stream& vectors_);
 
 //
 Matrix3x3 Mtx33Identity();
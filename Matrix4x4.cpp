@@ -1,6 +1,7 @@
 //
 #include "Matrix4x4.hpp"
-#include <algorithm> // std::swap()
+#include "Affine3D.hpp"
+#include "SIMD.hpp"
 #include <corecrt_math_defines.h> // M_PI
 
 constexpr float EPSILON = 0.0001f;
@@ -10,119 +11,214 @@ const Vector3D e1_3D{ 1, 0, 0 };
 const Vector3D e2_3D{ 0, 1, 0 };
 const Vector3D e3_3D{ 0, 0, 1 };
 
-//
-Matrix4x4::Matrix4x4(const float* pArr_)
-{
-	for (size_t i{ 0 }; i < _sz * _sz; ++i)
-	{ m[i] = *(pArr_ + i); }
-}
-
-//
-Matrix4x4::Matrix4x4(const float a00_, const float a01_, const float a02_, const float a03_,
-	const float a10_, const float a11_, const float a12_, const float a13_,
-	const float a20_, const float a21_, const float a22_, const float a23_,
-	const float a30_, const float a31_, const float a32_, const float a33_)
-{
-	a00 = a00_; a01 = a01_; a02 = a02_; a03 = a03_;
-	a10 = a10_; a11 = a11_; a12 = a12_; a13 = a13_;
-	a20 = a20_; a21 = a21_; a22 = a22_; a23 = a23_;
-	a30 = a30_; a31 = a31_; a32 = a32_; a33 = a33_;
-}
-
-//
-Matrix4x4& Matrix4x4::operator=(const Matrix4x4& rhs_)
+namespace
 {
-	// copy swap idiom
-	Matrix4x4 temp{ rhs_ };
-	Swap(temp);
-	return *this;
-}
-
-//
-Matrix4x4& Matrix4x4::operator+=(const Matrix4x4& rhs_)
-{ return *this = *this + rhs_; }
+	#if SIMD_SSE2
+	// 2x2 determinants of rows p_ and q_ over the column pairs picked by i_ and j_
+	__m128 SubDeterminants(const __m128 p_i_, const __m128 p_j_, const __m128 q_i_, const __m128 q_j_)
+	{ return _mm_sub_ps(_mm_mul_ps(p_i_, q_j_), _mm_mul_ps(p_j_, q_i_)); }
 
-//
-Matrix4x4& Matrix4x4::operator-=(const Matrix4x4& rhs_)
-{ return *this = *this - rhs_; }
+	// Laplace expansion over row pairs (0, 1) and (2, 3). Each cofactor column is
+	// r.X * V1 - r.Y * V2 + r.Z * V3 with alternating signs, where X/Y/Z pick
+	// columns {1,0,0,0}, {2,2,1,1}, {3,3,3,2} and V1/V2/V3 are the matching 2x2
+	// determinants of the other two rows. Returns the adjugate's columns.
+	void Adjugate(const Matrix4x4& mtx_, __m128* columns_)
+	{
+		const __m128 r0 = _mm_loadu_ps(mtx_.m2[0]), r1 = _mm_loadu_ps(mtx_.m2[1]);
+		const __m128 r2 = _mm_loadu_ps(mtx_.m2[2]), r3 = _mm_loadu_ps(mtx_.m2[3]);
+		#define SHUF_X(v_) _mm_shuffle_ps(v_, v_, _MM_SHUFFLE(0, 0, 0, 1))
+		#define SHUF_Y(v_) _mm_shuffle_ps(v_, v_, _MM_SHUFFLE(1, 1, 2, 2))
+		#define SHUF_Z(v_) _mm_shuffle_ps(v_, v_, _MM_SHUFFLE(2, 3, 3, 3))
+		const __m128 r0x = SHUF_X(r0), r0y = SHUF_Y(r0), r0z = SHUF_Z(r0);
+		const __m128 r1x = SHUF_X(r1), r1y = SHUF_Y(r1), r1z = SHUF_Z(r1);
+		const __m128 r2x = SHUF_X(r2), r2y = SHUF_Y(r2), r2z = SHUF_Z(r2);
+		const __m128 r3x = SHUF_X(r3), r3y = SHUF_Y(r3), r3z = SHUF_Z(r3);
+		#undef SHUF_X
+		#undef SHUF_Y
+		#undef SHUF_Z
 
-//
-Matrix4x4& Matrix4x4::operator*=(const Matrix4x4& rhs_)
-{ return *this = *this * rhs_; }
+		// rows 2 and 3, used by the cofactors of rows 0 and 1
+		const __m128 c1 = SubDeterminants(r2y, r2z, r3y, r3z);
+		const __m128 c2 = SubDeterminants(r2x, r2z, r3x, r3z);
+		const __m128 c3 = SubDeterminants(r2x, r2y, r3x, r3y);
+		// rows 0 and 1, used by the cofactors of rows 2 and 3
+		const __m128 s1 = SubDeterminants(r0y, r0z, r1y, r1z);
+		const __m128 s2 = SubDeterminants(r0x, r0z, r1x, r1z);
+		const __m128 s3 = SubDeterminants(r0x, r0y, r1x, r1y);
 
-//
-float Matrix4x4::Determinant() const
-{
-	return 0;
-}
-
-//
-void Matrix4x4::Swap(Matrix4x4& rhs_)
-{ std::swap((*this).m, rhs_.m); }
+		const __m128 sign_a = _mm_setr_ps(1, -1, 1, -1), sign_b = _mm_setr_ps(-1, 1, -1, 1);
+		columns_[0] = _mm_mul_ps(sign_a, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(r1x, c1), _mm_mul_ps(r1y, c2)), _mm_mul_ps(r1z, c3)));
+		columns_[1] = _mm_mul_ps(sign_b, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(r0x, c1), _mm_mul_ps(r0y, c2)), _mm_mul_ps(r0z, c3)));
+		columns_[2] = _mm_mul_ps(sign_a, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(r3x, s1), _mm_mul_ps(r3y, s2)), _mm_mul_ps(r3z, s3)));
+		columns_[3] = _mm_mul_ps(sign_b, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(r2x, s1), _mm_mul_ps(r2y, s2)), _mm_mul_ps(r2z, s3)));
+	}
 
-//
-Matrix4x4 operator+(const Matrix4x4& lhs_, const Matrix4x4& rhs_)
-{
-	Matrix4x4 result{ lhs_ };
-	for (size_t i{ 0 }; i < _sz * _sz; ++i)
-	{ result.m[i] += rhs_.m[i]; }
-	return result;
+	// first row dotted with the cofactors of the first row
+	float DeterminantFromAdjugate(const Matrix4x4& mtx_, const __m128* columns_)
+	{
+		const __m128 prod = _mm_mul_ps(_mm_loadu_ps(mtx_.m2[0]), columns_[0]);
+		const __m128 pairs = _mm_add_ps(prod, _mm_movehl_ps(prod, prod));
+		return _mm_cvtss_f32(_mm_add_ss(pairs, _mm_shuffle_ps(pairs, pairs, _MM_SHUFFLE(1, 1, 1, 1))));
+	}
+	#endif
 }
 
 //
-Matrix4x4 operator-(const Matrix4x4& lhs_, const Matrix4x4& rhs_)
+float MatrixDeterminant(const Matrix4x4& mtx_)
 {
-	Matrix4x4 result{ lhs_ };
-	for (size_t i{ 0 }; i < _sz * _sz; ++i)
-	{ result.m[i] -= rhs_.m[i]; }
-	return result;
+	#if SIMD_SSE2
+	__m128 columns[_sz];
+	Adjugate(mtx_, columns);
+	return DeterminantFromAdjugate(mtx_, columns);
+	#else
+	return MatrixDeterminant<float, _sz>(mtx_);
+	#endif
 }
 
 //
 Matrix4x4 operator*(const Matrix4x4& lhs_, const Matrix4x4& rhs_)
 {
-	float zeros[_sz * _sz] = { 0 };
-	Matrix4x4 result(zeros);
-
-	for (size_t i = 0; i < _sz * _sz; ++i)
+	Matrix4x4 result;
+	#if SIMD_SSE2
+	// row i of the result = sum over j of lhs_[i][j] * row j of rhs_
+	const __m128 r0 = _mm_loadu_ps(rhs_.m2[0]), r1 = _mm_loadu_ps(rhs_.m2[1]);
+	const __m128 r2 = _mm_loadu_ps(rhs_.m2[2]), r3 = _mm_loadu_ps(rhs_.m2[3]);
+	for (size_t i = 0; i < _sz; ++i)
+	{
+		__m128 row = _mm_mul_ps(_mm_set1_ps(lhs_.m2[i][0]), r0);
+		row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(lhs_.m2[i][1]), r1));
+		row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(lhs_.m2[i][2]), r2));
+		row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(lhs_.m2[i][3]), r3));
+		_mm_storeu_ps(result.m2[i], row);
+	}
+	#else
+	for (size_t i = 0; i < _sz; ++i)
 	{
 		for (size_t j = 0; j < _sz; ++j)
-		{ result.m[i] += lhs_.m[(i / _sz) * _sz + j] * rhs_.m[j * _sz + i % _sz]; }
+		{
+			result.m2[i][j] = lhs_.m2[i][0] * rhs_.m2[0][j] + lhs_.m2[i][1] * rhs_.m2[1][j] +
+				lhs_.m2[i][2] * rhs_.m2[2][j] + lhs_.m2[i][3] * rhs_.m2[3][j];
+		}
 	}
+	#endif
 	return result;
 }
 
-//
-Vector3D operator*(const Matrix4x4& mtx_, const Vector3D& rhs_)
+namespace
 {
-	const size_t n = 3; // # of dimensions of vector
-	Vector3D result(0, 0, 0);
+	// translation_ is 1 for points and 0 for directions
+	void TransformScalar(Vector3D* result_, const Matrix4x4& mtx_, const Vector3D* in_,
+		const float translation_, size_t begin_, const size_t n_)
+	{
+		for (; begin_ < n_; ++begin_)
+		{
+			const Vector3D v = in_[begin_];
+			result_[begin_] =
+			{
+				mtx_.a00 * v.x + mtx_.a01 * v.y + mtx_.a02 * v.z + mtx_.a03 * translation_,
+				mtx_.a10 * v.x + mtx_.a11 * v.y + mtx_.a12 * v.z + mtx_.a13 * translation_,
+				mtx_.a20 * v.x + mtx_.a21 * v.y + mtx_.a22 * v.z + mtx_.a23 * translation_
+			};
+		}
+	}
 
-	// applying effect of upper-left 3x3 submatrix of mtx_
-	for (size_t i = 0; i < n; ++i)
+	#if SIMD_X86
+	// one point per iteration: x * column0 + y * column1 + z * column2 + column3
+	SIMD_TARGET_SSE void TransformSSE(Vector3D* result_, const Matrix4x4& mtx_, const Vector3D* in_,
+		const float translation_, const size_t n_)
 	{
-		for (size_t j = 0; j < n; ++j)
-		{ result.m[i] += mtx_.m[i * _sz + j] * rhs_.m[j]; }
+		const __m128 c0 = _mm_setr_ps(mtx_.a00, mtx_.a10, mtx_.a20, 0.0f);
+		const __m128 c1 = _mm_setr_ps(mtx_.a01, mtx_.a11, mtx_.a21, 0.0f);
+		const __m128 c2 = _mm_setr_ps(mtx_.a02, mtx_.a12, mtx_.a22, 0.0f);
+		const __m128 c3 = _mm_mul_ps(_mm_setr_ps(mtx_.a03, mtx_.a13, mtx_.a23, 0.0f), _mm_set1_ps(translation_));
+		for (size_t i{ 0 }; i < n_; ++i)
+		{
+			__m128 r = _mm_add_ps(c3, _mm_mul_ps(_mm_set1_ps(in_[i].x), c0));
+			r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(in_[i].y), c1));
+			r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(in_[i].z), c2));
+			// 12 byte store, a 16 byte one would clobber the next element
+			_mm_storel_pi(reinterpret_cast<__m64*>(result_[i].m), r);
+			_mm_store_ss(result_[i].m + 2, _mm_movehl_ps(r, r));
+		}
 	}
 
-	// translation
-	for (size_t i = 0; i < n; ++i)
-	{ result.m[i] += mtx_.m[i * _sz + (_sz - 1)]; }
-	return result;
-}
+	// eight points per iteration, deinterleaved from xyz triples into x[8], y[8], z[8]
+	SIMD_TARGET_AVX2 void TransformAVX2(Vector3D* result_, const Matrix4x4& mtx_, const Vector3D* in_,
+		const float translation_, const size_t n_)
+	{
+		const __m256 a00 = _mm256_set1_ps(mtx_.a00), a01 = _mm256_set1_ps(mtx_.a01), a02 = _mm256_set1_ps(mtx_.a02);
+		const __m256 a10 = _mm256_set1_ps(mtx_.a10), a11 = _mm256_set1_ps(mtx_.a11), a12 = _mm256_set1_ps(mtx_.a12);
+		const __m256 a20 = _mm256_set1_ps(mtx_.a20), a21 = _mm256_set1_ps(mtx_.a21), a22 = _mm256_set1_ps(mtx_.a22);
+		const __m256 a03 = _mm256_set1_ps(mtx_.a03 * translation_);
+		const __m256 a13 = _mm256_set1_ps(mtx_.a13 * translation_);
+		const __m256 a23 = _mm256_set1_ps(mtx_.a23 * translation_);
 
-//
-Matrix4x4 Mtx44Identity()
-{
-	Matrix4x4 result;
-	for (size_t i = 0; i < _sz; ++i)
+		static_assert(sizeof(Vector3D) == 3 * sizeof(float), "Vector3D must be tightly packed");
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const float* src = in_[i].m;
+			// lanes: m03 = x0y0z0x1|x4y4z4x5, m14 = y1z1x2y2|y5z5x6y6, m25 = z2x3y3z3|z6x7y7z7
+			const __m256 m03 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(src + 0)), _mm_loadu_ps(src + 12), 1);
+			const __m256 m14 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(src + 4)), _mm_loadu_ps(src + 16), 1);
+			const __m256 m25 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(src + 8)), _mm_loadu_ps(src + 20), 1);
+			const __m256 xy = _mm256_shuffle_ps(m14, m25, _MM_SHUFFLE(2, 1, 3, 2));
+			const __m256 yz = _mm256_shuffle_ps(m03, m14, _MM_SHUFFLE(1, 0, 2, 1));
+			const __m256 x = _mm256_shuffle_ps(m03, xy, _MM_SHUFFLE(2, 0, 3, 0));
+			const __m256 y = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+			const __m256 z = _mm256_shuffle_ps(yz, m25, _MM_SHUFFLE(3, 0, 3, 1));
+
+			const __m256 rx = _mm256_fmadd_ps(a02, z, _mm256_fmadd_ps(a01, y, _mm256_fmadd_ps(a00, x, a03)));
+			const __m256 ry = _mm256_fmadd_ps(a12, z, _mm256_fmadd_ps(a11, y, _mm256_fmadd_ps(a10, x, a13)));
+			const __m256 rz = _mm256_fmadd_ps(a22, z, _mm256_fmadd_ps(a21, y, _mm256_fmadd_ps(a20, x, a23)));
+
+			// reverse of the shuffle above
+			const __m256 rxy = _mm256_shuffle_ps(rx, ry, _MM_SHUFFLE(2, 0, 2, 0));
+			const __m256 ryz = _mm256_shuffle_ps(ry, rz, _MM_SHUFFLE(3, 1, 3, 1));
+			const __m256 rzx = _mm256_shuffle_ps(rz, rx, _MM_SHUFFLE(3, 1, 2, 0));
+			const __m256 r03 = _mm256_shuffle_ps(rxy, rzx, _MM_SHUFFLE(2, 0, 2, 0));
+			const __m256 r14 = _mm256_shuffle_ps(ryz, rxy, _MM_SHUFFLE(3, 1, 2, 0));
+			const __m256 r25 = _mm256_shuffle_ps(rzx, ryz, _MM_SHUFFLE(3, 1, 3, 1));
+
+			float* dst = result_[i].m;
+			_mm_storeu_ps(dst + 0, _mm256_castps256_ps128(r03));
+			_mm_storeu_ps(dst + 4, _mm256_castps256_ps128(r14));
+			_mm_storeu_ps(dst + 8, _mm256_castps256_ps128(r25));
+			_mm_storeu_ps(dst + 12, _mm256_extractf128_ps(r03, 1));
+			_mm_storeu_ps(dst + 16, _mm256_extractf128_ps(r14, 1));
+			_mm_storeu_ps(dst + 20, _mm256_extractf128_ps(r25, 1));
+		}
+		TransformScalar(result_, mtx_, in_, translation_, i, n_);
+	}
+	#endif
+
+	//
+	void Transform(Vector3D* result_, const Matrix4x4& mtx_, const Vector3D* in_,
+		const float translation_, const size_t n_)
 	{
-		for (size_t j = 0; j < _sz; ++j)
-		{ result.m[i * _sz + j] = (i == j) ? 1.0f : 0.0f; }
+		switch (SIMDGetLevel())
+		{
+		#if SIMD_X86
+		case SIMDLevel::AVX2: TransformAVX2(result_, mtx_, in_, translation_, n_); break;
+		case SIMDLevel::SSE: TransformSSE(result_, mtx_, in_, translation_, n_); break;
+		#endif
+		default: TransformScalar(result_, mtx_, in_, translation_, 0, n_); break;
+		}
 	}
-	return result;
 }
 
+//
+void Mtx44TransformPoints(Vector3D* result_, const Matrix4x4& mtx_, const Vector3D* points_, const size_t count_)
+{ Transform(result_, mtx_, points_, 1.0f, count_); }
+
+//
+void Mtx44TransformVectors(Vector3D* result_, const Matrix4x4& mtx_, const Vector3D* vectors_, const size_t count_)
+{ Transform(result_, mtx_, vectors_, 0.0f, count_); }
+
+//
+Matrix4x4 Mtx44Identity()
+{ return MatrixIdentity<float, _sz>(); }
+
 //
 Matrix4x4 Mtx44Translate(const float x_, const float y_, const float z_)
 {
@@ -236,19 +332,112 @@ Matrix4x4 Mtx44Proj(const Vector3D& normal_)
 
 //
 Matrix4x4 Mtx44Transpose(const Matrix4x4& mtx_)
+{ return MatrixTranspose(mtx_); }
+
+//
+Matrix4x4 Mtx44Inverse(Matrix4x4* result_, float* determinant_, const Matrix4x4& mtx_)
 {
-	Matrix4x4 result = Mtx44Identity();
+	#if SIMD_SSE2
+	__m128 columns[_sz];
+	Adjugate(mtx_, columns);
+	*determinant_ = DeterminantFromAdjugate(mtx_, columns);
+	#else
+	*determinant_ = mtx_.Determinant();
+	#endif
+
+	if (-EPSILON <= *determinant_ && *determinant_ <= EPSILON)
+	{
+		result_ = nullptr;
+		throw "Determinant = 0 in Mtx44Inverse()";
+	}
+
+	#if SIMD_SSE2
+	// adjugate columns -> rows, then divide by the determinant
+	_MM_TRANSPOSE4_PS(columns[0], columns[1], columns[2], columns[3]);
+	const __m128 inv_det = _mm_set1_ps(1.0f / *determinant_);
+	for (size_t i = 0; i < _sz; ++i)
+	{ _mm_storeu_ps(result_->m2[i], _mm_mul_ps(columns[i], inv_det)); }
+	#else
+	// cofactor C(i, j) = (-1)^(i + j) * minor(i, j), inverse(j, i) = C(i, j) / det
 	for (size_t i = 0; i < _sz; ++i)
 	{
 		for (size_t j = 0; j < _sz; ++j)
-		{ result.m[i * _sz + j] = mtx_.m[j * _sz + i]; }
-		// swapped the i and j for mtx_
+		{
+			// rows other than i and columns other than j, in order
+			size_t r[_sz - 1], k[_sz - 1];
+			for (size_t n = 0, rn = 0, kn = 0; n < _sz; ++n)
+			{
+				if (n != i) { r[rn++] = n; }
+				if (n != j) { k[kn++] = n; }
+			}
+			const float minor =
+				mtx_.m2[r[0]][k[0]] * (mtx_.m2[r[1]][k[1]] * mtx_.m2[r[2]][k[2]] - mtx_.m2[r[1]][k[2]] * mtx_.m2[r[2]][k[1]]) -
+				mtx_.m2[r[0]][k[1]] * (mtx_.m2[r[1]][k[0]] * mtx_.m2[r[2]][k[2]] - mtx_.m2[r[1]][k[2]] * mtx_.m2[r[2]][k[0]]) +
+				mtx_.m2[r[0]][k[2]] * (mtx_.m2[r[1]][k[0]] * mtx_.m2[r[2]][k[1]] - mtx_.m2[r[1]][k[1]] * mtx_.m2[r[2]][k[0]]);
+			const float sign = ((i + j) % 2 == 0) ? 1.0f : -1.0f;
+			result_->m2[j][i] = sign * minor / *determinant_;
+		}
 	}
-	return result;
+	#endif
+	return *result_;
 }
 
 //
-Matrix4x4 Mtx44Inverse(Matrix4x4* result_, float* determinant_, const Matrix4x4& mtx_)
+Mtx44Kind Mtx44Classify(const Matrix4x4& mtx_)
 {
-	return {};
+	if (mtx_.a30 < -EPSILON || EPSILON < mtx_.a30 ||
+		mtx_.a31 < -EPSILON || EPSILON < mtx_.a31 ||
+		mtx_.a32 < -EPSILON || EPSILON < mtx_.a32 ||
+		mtx_.a33 < 1 - EPSILON || 1 + EPSILON < mtx_.a33)
+	{ return Mtx44Kind::General; }
+
+	// columns of the 3x3 part must be orthonormal: R^T * R == I
+	const Vector3D c0{ mtx_.a00, mtx_.a10, mtx_.a20 };
+	const Vector3D c1{ mtx_.a01, mtx_.a11, mtx_.a21 };
+	const Vector3D c2{ mtx_.a02, mtx_.a12, mtx_.a22 };
+	const float checks[] =
+	{
+		Vector3DDotProduct(c0, c0) - 1, Vector3DDotProduct(c1, c1) - 1, Vector3DDotProduct(c2, c2) - 1,
+		Vector3DDotProduct(c0, c1), Vector3DDotProduct(c0, c2), Vector3DDotProduct(c1, c2)
+	};
+	for (const float check : checks)
+	{
+		if (check < -EPSILON || EPSILON < check)
+		{ return Mtx44Kind::Affine; }
+	}
+	return Mtx44Kind::Rigid;
+}
+
+//
+Matrix4x4 Mtx44InverseRigid(const Matrix4x4& mtx_)
+{
+	// [R t]^-1 = [R^T, -R^T * t]
+	const float tx = mtx_.a03, ty = mtx_.a13, tz = mtx_.a23;
+	return
+	{
+		mtx_.a00, mtx_.a10, mtx_.a20, -(mtx_.a00 * tx + mtx_.a10 * ty + mtx_.a20 * tz),
+		mtx_.a01, mtx_.a11, mtx_.a21, -(mtx_.a01 * tx + mtx_.a11 * ty + mtx_.a21 * tz),
+		mtx_.a02, mtx_.a12, mtx_.a22, -(mtx_.a02 * tx + mtx_.a12 * ty + mtx_.a22 * tz),
+		0, 0, 0, 1
+	};
+}
+
+//
+Matrix4x4 Mtx44InverseAffine(const Matrix4x4& mtx_)
+{ return Mtx44FromAffine3D(Affine3DInverse(Affine3D(mtx_))); }
+
+//
+Matrix4x4 Mtx44InverseFast(const Matrix4x4& mtx_)
+{
+	switch (Mtx44Classify(mtx_))
+	{
+	case Mtx44Kind::Rigid: return Mtx44InverseRigid(mtx_);
+	case Mtx44Kind::Affine: return Mtx44InverseAffine(mtx_);
+	default:
+	{
+		Matrix4x4 result;
+		float determinant;
+		return Mtx44Inverse(&result, &determinant, mtx_);
+	}
+	}
 }
@@ -3,77 +3,32 @@
 #ifndef MATRIX4X4_H_
 #define MATRIX4X4_H_
 
+#include "Matrix.hpp"
 #include "Vector3D.hpp"
 
 extern const Vector3D e1_3D; // {1, 0, 0}
 extern const Vector3D e2_3D; // {0, 1, 0}
 extern const Vector3D e3_3D; // {0, 0, 1}
 
-//
-typedef union Matrix4x4
-{
-	// some warning about a nameless struct
-	// but it's way more convenient this way :(
-	struct
-	{
-		float a00, a01, a02, a03;
-		float a10, a11, a12, a13;
-		float a20, a21, a22, a23;
-		float a30, a31, a32, a33;
-	};
-
-	float m[16]{};
-	float m2[4][4];
-
-	/* Constructors */
-
-	//
-	Matrix4x4() = default; // all values initialized to 0.0f
-
-	//
-	explicit Matrix4x4(const float* pArr_);
-
-	//
-	Matrix4x4(float a00_, float a01_, float a02_, float a03_,
-		float a10_, float a11_, float a12_, float a13_,
-		float a20_, float a21_, float a22_, float a23_,
-		float a30_, float a31_, float a32_, float a33_);
-
-	/* Assignment operators */
-
-	//
-	Matrix4x4& operator=(const Matrix4x4& rhs_);
-
-	//
-	Matrix4x4& operator+=(const Matrix4x4& rhs_);
-
-	//
-	Matrix4x4& operator-=(const Matrix4x4& rhs_);
-
-	//
-	Matrix4x4& operator*=(const Matrix4x4& rhs_);
-
-	/* Others */
-
-	//
-	float Determinant() const;
-
-	//
-	void Swap(Matrix4x4& rhs_);
+// a00 ... a33 view of Matrix<float, 4>, see Matrix.hpp for the members and operators
+using Matrix4x4 = Matrix<float, 4>;
+using Mtx44 = Matrix4x4;
 
-}Matrix4x4, Mtx44;
+// double precision for large-world coordinates
+using Matrix4x4d = Matrix<double, 4>;
+using Mtx44d = Matrix4x4d;
 
-//
-Matrix4x4 operator+(const Matrix4x4& lhs_, const Matrix4x4& rhs_);
+// SSE row broadcast, preferred over the generic template for float
+Matrix4x4 operator*(const Matrix4x4& lhs_, const Matrix4x4& rhs_);
 
-//
-Matrix4x4 operator-(const Matrix4x4& lhs_, const Matrix4x4& rhs_);
+// SSE Laplace expansion, what Matrix4x4::Determinant() ends up calling
+float MatrixDeterminant(const Matrix4x4& mtx_);
 
-//
-Matrix4x4 operator*(const Matrix4x4& lhs_, const Matrix4x4& rhs_);
+// transforms count_ points (translation applied), result_ may alias points_
+void Mtx44TransformPoints(Vector3D* result_, const Matrix4x4& mtx_, const Vector3D* points_, size_t count_);
 
-//
-Vector3D operator*(const Matrix4x4& mtx_, const Vector3D& rhs_);
+// transforms count_ directions (translation ignored), result_ may alias vectors_
+void Mtx44TransformVectors(Vector3D* result_, const Matrix4x4& mtx_, const Vector3D* vectors_, size_t count_);
 
 //
 Matrix4x4 Mtx44Identity();
@@ -102,4 +57,24 @@ Matrix4x4 Mtx44Transpose(const Matrix4x4& mtx_);
 //
 Matrix4x4 Mtx44Inverse(Matrix4x4* result_, float* determinant_, const Matrix4x4& mtx_);
 
+//
+enum class Mtx44Kind
+{
+	General,
+	Affine, // last row is {0, 0, 0, 1}
+	Rigid // affine with an orthonormal 3x3 part (rotation + translation)
+};
+
+//
+Mtx44Kind Mtx44Classify(const Matrix4x4& mtx_);
+
+// transposes the rotation and negates the rotated translation, assumes mtx_ is rigid
+Matrix4x4 Mtx44InverseRigid(const Matrix4x4& mtx_);
+
+// 3x3 inverse plus translation, throws if mtx_ is not affine or is singular
+Matrix4x4 Mtx44InverseAffine(const Matrix4x4& mtx_);
+
+// Mtx44Classify() then the cheapest inverse that applies
+Matrix4x4 Mtx44InverseFast(const Matrix4x4& mtx_);
+
 #endif // MATRIX4X4_H_
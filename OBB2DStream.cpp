@@ -0,0 +1,104 @@
+//
+#include "OBB2DStream.hpp"
+#include <cstring> // memcpy(), memset()
+#include <utility> // std::swap()
+
+//
+OBB2DStream::OBB2DStream(const OBB2D* pArr_, const size_t size_)
+{
+	Reserve(size_);
+	for (size_t i{ 0 }; i < size_; ++i)
+	{ Set(i, pArr_[i]); }
+	size = size_;
+}
+
+//
+OBB2DStream::OBB2DStream(const OBB2DStream& rhs_)
+{
+	Reserve(rhs_.size);
+	if (rhs_.size)
+	{
+		memcpy(center_x, rhs_.center_x, rhs_.size * sizeof(float));
+		memcpy(center_y, rhs_.center_y, rhs_.size * sizeof(float));
+		memcpy(half_x, rhs_.half_x, rhs_.size * sizeof(float));
+		memcpy(half_y, rhs_.half_y, rhs_.size * sizeof(float));
+		memcpy(rot_c, rhs_.rot_c, rhs_.size * sizeof(float));
+		memcpy(rot_s, rhs_.rot_s, rhs_.size * sizeof(float));
+	}
+	size = rhs_.size;
+}
+
+//
+OBB2DStream::OBB2DStream(OBB2DStream&& rhs_) noexcept
+{ Swap(rhs_); }
+
+//
+OBB2DStream::~OBB2DStream()
+{ SIMDAlignedFree(center_x); }
+
+//
+OBB2DStream& OBB2DStream::operator=(OBB2DStream rhs_)
+{
+	// copy swap idiom
+	Swap(rhs_);
+	return *this;
+}
+
+//
+void OBB2DStream::Reserve(const size_t capacity_)
+{
+	if (capacity_ <= capacity)
+	{ return; }
+
+	// the six arrays share one block, each starts right after the last one's padding
+	const size_t padded = SIMDPaddedSize(capacity_);
+	float* block = static_cast<float*>(SIMDAlignedAlloc(6 * padded * sizeof(float)));
+	memset(block, 0, 6 * padded * sizeof(float));
+	if (size)
+	{
+		memcpy(block, center_x, size * sizeof(float));
+		memcpy(block + padded, center_y, size * sizeof(float));
+		memcpy(block + 2 * padded, half_x, size * sizeof(float));
+		memcpy(block + 3 * padded, half_y, size * sizeof(float));
+		memcpy(block + 4 * padded, rot_c, size * sizeof(float));
+		memcpy(block + 5 * padded, rot_s, size * sizeof(float));
+	}
+	SIMDAlignedFree(center_x);
+	center_x = block;
+	center_y = block + padded;
+	half_x = block + 2 * padded;
+	half_y = block + 3 * padded;
+	rot_c = block + 4 * padded;
+	rot_s = block + 5 * padded;
+	capacity = padded;
+}
+
+//
+void OBB2DStream::PushBack(const OBB2D& obb_)
+{
+	if (size == capacity)
+	{ Reserve(capacity ? capacity * 2 : SIMD_WIDTH); }
+	Set(size++, obb_);
+}
+
+//
+void OBB2DStream::Clear()
+{
+	// zero what was in use so the padding stays zero
+	for (size_t f{ 0 }; f < 6 && size; ++f)
+	{ memset(center_x + f * capacity, 0, size * sizeof(float)); }
+	size = 0;
+}
+
+//
+void OBB2DStream::Swap(OBB2DStream& rhs_) noexcept
+{
+	std::swap(center_x, rhs_.center_x);
+	std::swap(center_y, rhs_.center_y);
+	std::swap(half_x, rhs_.half_x);
+	std::swap(half_y, rhs_.half_y);
+	std::swap(rot_c, rhs_.rot_c);
+	std::swap(rot_s, rhs_.rot_s);
+	std::swap(size, rhs_.size);
+	std::swap(capacity, rhs_.capacity);
+}
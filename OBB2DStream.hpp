@@ -0,0 +1,82 @@
+//
+#pragma once
+#ifndef OBB2D_STREAM_HPP_
+#define OBB2D_STREAM_HPP_
+
+#include "SIMD.hpp"
+#include "Types.hpp"
+
+// structure-of-arrays OBB2D storage, one array per scalar member. Like
+// Vec2Stream all six arrays share one SIMD_ALIGNMENT aligned block, zero
+// padded to a multiple of SIMD_WIDTH.
+struct OBB2DStream
+{
+	float* center_x{ nullptr };
+	float* center_y{ nullptr };
+	float* half_x{ nullptr };
+	float* half_y{ nullptr };
+	float* rot_c{ nullptr };
+	float* rot_s{ nullptr };
+
+	/* Constructors */
+
+	//
+	OBB2DStream() = default;
+
+	//
+	OBB2DStream(const OBB2D* pArr_, size_t size_);
+
+	//
+	OBB2DStream(const OBB2DStream& rhs_);
+
+	//
+	OBB2DStream(OBB2DStream&& rhs_) noexcept;
+
+	//
+	~OBB2DStream();
+
+	/* Assignment Operators */
+
+	//
+	OBB2DStream& operator=(OBB2DStream rhs_);
+
+	/* Others */
+
+	//
+	size_t Size() const
+	{ return size; }
+
+	//
+	size_t Capacity() const
+	{ return capacity; }
+
+	//
+	OBB2D Get(size_t i_) const
+	{ return { { center_x[i_], center_y[i_] }, { half_x[i_], half_y[i_] }, Rot2{ rot_c[i_], rot_s[i_] } }; }
+
+	//
+	void Set(size_t i_, const OBB2D& obb_)
+	{
+		center_x[i_] = obb_.center.x; center_y[i_] = obb_.center.y;
+		half_x[i_] = obb_.half_ext.x; half_y[i_] = obb_.half_ext.y;
+		rot_c[i_] = obb_.rot.c; rot_s[i_] = obb_.rot.s;
+	}
+
+	//
+	void Reserve(size_t capacity_);
+
+	//
+	void PushBack(const OBB2D& obb_);
+
+	//
+	void Clear();
+
+	//
+	void Swap(OBB2DStream& rhs_) noexcept;
+
+private:
+	size_t size{ 0 };
+	size_t capacity{ 0 };
+};
+
+#endif // OBB2D_STREAM_HPP_
@@ -0,0 +1,360 @@
+//
+#include "Quaternion.hpp"
+#include "SIMD.hpp"
+
+namespace
+{
+	// Eberly, "A Fast and Accurate Algorithm for Computing SLERP": with x = cos(theta),
+	// sin(t * theta) / sin(theta) = t * (1 + b1 * (1 + b2 * (... (1 + bn)))), where
+	// bi = (t^2 / (i * (2i + 1)) - i / (2i + 1)) * (x - 1). The last term is scaled by
+	// a correction factor; 12 terms with the factor refit for that count keep the
+	// weights within 7e-7 over x in [0, 1] (8 terms as in the paper only reach 2e-5).
+	constexpr size_t SLERP_TERMS = 12;
+	constexpr float SLERP_MU = 1.89372497f;
+
+	// (ui * t^2 - vi) only depends on t, so with one t_ for the whole batch it is hoisted
+	struct SlerpCoefficients
+	{
+		float from[SLERP_TERMS];
+		float to[SLERP_TERMS];
+
+		explicit SlerpCoefficients(const float t_)
+		{
+			for (size_t i{ 1 }; i <= SLERP_TERMS; ++i)
+			{
+				const float mu = i == SLERP_TERMS ? SLERP_MU : 1.0f;
+				const float u = mu / static_cast<float>(i * (2 * i + 1));
+				const float v = mu * static_cast<float>(i) / static_cast<float>(2 * i + 1);
+				from[i - 1] = u * (1.0f - t_) * (1.0f - t_) - v;
+				to[i - 1] = u * t_ * t_ - v;
+			}
+		}
+	};
+
+	//
+	void NlerpScalar(Quaternion* result_, const Quaternion* from_, const Quaternion* to_, const float t_,
+		size_t begin_, const size_t count_)
+	{
+		for (; begin_ < count_; ++begin_)
+		{ result_[begin_] = QuatNlerp(from_[begin_], to_[begin_], t_); }
+	}
+
+	//
+	void SlerpScalar(Quaternion* result_, const Quaternion* from_, const Quaternion* to_, const float t_,
+		const SlerpCoefficients& coef_, size_t begin_, const size_t count_)
+	{
+		for (; begin_ < count_; ++begin_)
+		{
+			const Quaternion a = from_[begin_];
+			const Quaternion b = to_[begin_];
+			const float dot = QuatDotProduct(a, b);
+			const float sign = dot < 0 ? -1.0f : 1.0f;
+			const float xm1 = dot * sign - 1.0f;
+
+			float w_from = 1.0f, w_to = 1.0f;
+			for (size_t i{ SLERP_TERMS }; i-- > 0;)
+			{
+				w_from = 1.0f + coef_.from[i] * xm1 * w_from;
+				w_to = 1.0f + coef_.to[i] * xm1 * w_to;
+			}
+			w_from *= 1.0f - t_;
+			w_to *= t_ * sign;
+
+			result_[begin_] =
+			{
+				w_from * a.x + w_to * b.x, w_from * a.y + w_to * b.y,
+				w_from * a.z + w_to * b.z, w_from * a.w + w_to * b.w
+			};
+		}
+	}
+
+	#if SIMD_X86
+	// 4 quaternions in, x[] y[] z[] w[] out and vice versa, the transpose is its own inverse
+	SIMD_TARGET_SSE inline void TransposeSSE(__m128& r0_, __m128& r1_, __m128& r2_, __m128& r3_)
+	{ _MM_TRANSPOSE4_PS(r0_, r1_, r2_, r3_); }
+
+	// as TransposeSSE() within each 128-bit lane, so row k holds quaternions k and k + 4
+	SIMD_TARGET_AVX2 inline void TransposeAVX2(__m256& r0_, __m256& r1_, __m256& r2_, __m256& r3_)
+	{
+		const __m256 t0 = _mm256_unpacklo_ps(r0_, r1_), t1 = _mm256_unpacklo_ps(r2_, r3_);
+		const __m256 t2 = _mm256_unpackhi_ps(r0_, r1_), t3 = _mm256_unpackhi_ps(r2_, r3_);
+		r0_ = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+		r1_ = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+		r2_ = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+		r3_ = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+	}
+
+	//
+	SIMD_TARGET_AVX2 inline __m256 LoadPairAVX2(const Quaternion* quat_)
+	{ return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(quat_[0].m)), _mm_loadu_ps(quat_[4].m), 1); }
+
+	//
+	SIMD_TARGET_AVX2 inline void StorePairAVX2(Quaternion* quat_, const __m256 pair_)
+	{
+		_mm_storeu_ps(quat_[0].m, _mm256_castps256_ps128(pair_));
+		_mm_storeu_ps(quat_[4].m, _mm256_extractf128_ps(pair_, 1));
+	}
+
+	//
+	SIMD_TARGET_SSE void NlerpSSE(Quaternion* result_, const Quaternion* from_, const Quaternion* to_, const float t_,
+		const size_t count_)
+	{
+		const __m128 sign_mask = _mm_set1_ps(-0.0f);
+		const __m128 w_from = _mm_set1_ps(1.0f - t_), w_to = _mm_set1_ps(t_);
+		size_t i{ 0 };
+		for (; i + 4 <= count_; i += 4)
+		{
+			__m128 ax = _mm_loadu_ps(from_[i].m), ay = _mm_loadu_ps(from_[i + 1].m);
+			__m128 az = _mm_loadu_ps(from_[i + 2].m), aw = _mm_loadu_ps(from_[i + 3].m);
+			__m128 bx = _mm_loadu_ps(to_[i].m), by = _mm_loadu_ps(to_[i + 1].m);
+			__m128 bz = _mm_loadu_ps(to_[i + 2].m), bw = _mm_loadu_ps(to_[i + 3].m);
+			TransposeSSE(ax, ay, az, aw);
+			TransposeSSE(bx, by, bz, bw);
+
+			// flip to so both are on the same hemisphere
+			const __m128 dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)),
+				_mm_add_ps(_mm_mul_ps(az, bz), _mm_mul_ps(aw, bw)));
+			const __m128 w_to_signed = _mm_xor_ps(w_to, _mm_and_ps(dot, sign_mask));
+
+			__m128 rx = _mm_add_ps(_mm_mul_ps(w_from, ax), _mm_mul_ps(w_to_signed, bx));
+			__m128 ry = _mm_add_ps(_mm_mul_ps(w_from, ay), _mm_mul_ps(w_to_signed, by));
+			__m128 rz = _mm_add_ps(_mm_mul_ps(w_from, az), _mm_mul_ps(w_to_signed, bz));
+			__m128 rw = _mm_add_ps(_mm_mul_ps(w_from, aw), _mm_mul_ps(w_to_signed, bw));
+
+			// same rsqrt + Newton-Raphson step as SIMDInvSqrtFast()
+			const __m128 len_sq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(rx, rx), _mm_mul_ps(ry, ry)),
+				_mm_add_ps(_mm_mul_ps(rz, rz), _mm_mul_ps(rw, rw)));
+			const __m128 y = _mm_rsqrt_ps(len_sq);
+			const __m128 inv = _mm_mul_ps(y, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), len_sq), _mm_mul_ps(y, y))));
+			rx = _mm_mul_ps(rx, inv); ry = _mm_mul_ps(ry, inv);
+			rz = _mm_mul_ps(rz, inv); rw = _mm_mul_ps(rw, inv);
+
+			TransposeSSE(rx, ry, rz, rw);
+			_mm_storeu_ps(result_[i].m, rx); _mm_storeu_ps(result_[i + 1].m, ry);
+			_mm_storeu_ps(result_[i + 2].m, rz); _mm_storeu_ps(result_[i + 3].m, rw);
+		}
+		NlerpScalar(result_, from_, to_, t_, i, count_);
+	}
+
+	//
+	SIMD_TARGET_AVX2 void NlerpAVX2(Quaternion* result_, const Quaternion* from_, const Quaternion* to_, const float t_,
+		const size_t count_)
+	{
+		const __m256 sign_mask = _mm256_set1_ps(-0.0f);
+		const __m256 w_from = _mm256_set1_ps(1.0f - t_), w_to = _mm256_set1_ps(t_);
+		size_t i{ 0 };
+		for (; i + 8 <= count_; i += 8)
+		{
+			__m256 ax = LoadPairAVX2(from_ + i), ay = LoadPairAVX2(from_ + i + 1);
+			__m256 az = LoadPairAVX2(from_ + i + 2), aw = LoadPairAVX2(from_ + i + 3);
+			__m256 bx = LoadPairAVX2(to_ + i), by = LoadPairAVX2(to_ + i + 1);
+			__m256 bz = LoadPairAVX2(to_ + i + 2), bw = LoadPairAVX2(to_ + i + 3);
+			TransposeAVX2(ax, ay, az, aw);
+			TransposeAVX2(bx, by, bz, bw);
+
+			const __m256 dot = _mm256_fmadd_ps(ax, bx, _mm256_fmadd_ps(ay, by, _mm256_fmadd_ps(az, bz, _mm256_mul_ps(aw, bw))));
+			const __m256 w_to_signed = _mm256_xor_ps(w_to, _mm256_and_ps(dot, sign_mask));
+
+			__m256 rx = _mm256_fmadd_ps(w_from, ax, _mm256_mul_ps(w_to_signed, bx));
+			__m256 ry = _mm256_fmadd_ps(w_from, ay, _mm256_mul_ps(w_to_signed, by));
+			__m256 rz = _mm256_fmadd_ps(w_from, az, _mm256_mul_ps(w_to_signed, bz));
+			__m256 rw = _mm256_fmadd_ps(w_from, aw, _mm256_mul_ps(w_to_signed, bw));
+
+			const __m256 len_sq = _mm256_fmadd_ps(rx, rx, _mm256_fmadd_ps(ry, ry, _mm256_fmadd_ps(rz, rz, _mm256_mul_ps(rw, rw))));
+			const __m256 y = _mm256_rsqrt_ps(len_sq);
+			const __m256 inv = _mm256_mul_ps(y, _mm256_fnmadd_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), len_sq), _mm256_mul_ps(y, y), _mm256_set1_ps(1.5f)));
+			rx = _mm256_mul_ps(rx, inv); ry = _mm256_mul_ps(ry, inv);
+			rz = _mm256_mul_ps(rz, inv); rw = _mm256_mul_ps(rw, inv);
+
+			TransposeAVX2(rx, ry, rz, rw);
+			StorePairAVX2(result_ + i, rx); StorePairAVX2(result_ + i + 1, ry);
+			StorePairAVX2(result_ + i + 2, rz); StorePairAVX2(result_ + i + 3, rw);
+		}
+		NlerpScalar(result_, from_, to_, t_, i, count_);
+	}
+
+	//
+	SIMD_TARGET_SSE void SlerpSSE(Quaternion* result_, const Quaternion* from_, const Quaternion* to_, const float t_,
+		const SlerpCoefficients& coef_, const size_t count_)
+	{
+		const __m128 sign_mask = _mm_set1_ps(-0.0f);
+		const __m128 one = _mm_set1_ps(1.0f);
+		size_t i{ 0 };
+		for (; i + 4 <= count_; i += 4)
+		{
+			__m128 ax = _mm_loadu_ps(from_[i].m), ay = _mm_loadu_ps(from_[i + 1].m);
+			__m128 az = _mm_loadu_ps(from_[i + 2].m), aw = _mm_loadu_ps(from_[i + 3].m);
+			__m128 bx = _mm_loadu_ps(to_[i].m), by = _mm_loadu_ps(to_[i + 1].m);
+			__m128 bz = _mm_loadu_ps(to_[i + 2].m), bw = _mm_loadu_ps(to_[i + 3].m);
+			TransposeSSE(ax, ay, az, aw);
+			TransposeSSE(bx, by, bz, bw);
+
+			const __m128 dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)),
+				_mm_add_ps(_mm_mul_ps(az, bz), _mm_mul_ps(aw, bw)));
+			const __m128 sign = _mm_and_ps(dot, sign_mask);
+			const __m128 xm1 = _mm_sub_ps(_mm_andnot_ps(sign_mask, dot), one);
+
+			__m128 w_from = one, w_to = one;
+			for (size_t k{ SLERP_TERMS }; k-- > 0;)
+			{
+				w_from = _mm_add_ps(one, _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(coef_.from[k]), xm1), w_from));
+				w_to = _mm_add_ps(one, _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(coef_.to[k]), xm1), w_to));
+			}
+			w_from = _mm_mul_ps(w_from, _mm_set1_ps(1.0f - t_));
+			w_to = _mm_xor_ps(_mm_mul_ps(w_to, _mm_set1_ps(t_)), sign);
+
+			__m128 rx = _mm_add_ps(_mm_mul_ps(w_from, ax), _mm_mul_ps(w_to, bx));
+			__m128 ry = _mm_add_ps(_mm_mul_ps(w_from, ay), _mm_mul_ps(w_to, by));
+			__m128 rz = _mm_add_ps(_mm_mul_ps(w_from, az), _mm_mul_ps(w_to, bz));
+			__m128 rw = _mm_add_ps(_mm_mul_ps(w_from, aw), _mm_mul_ps(w_to, bw));
+
+			TransposeSSE(rx, ry, rz, rw);
+			_mm_storeu_ps(result_[i].m, rx); _mm_storeu_ps(result_[i + 1].m, ry);
+			_mm_storeu_ps(result_[i + 2].m, rz); _mm_storeu_ps(result_[i + 3].m, rw);
+		}
+		SlerpScalar(result_, from_, to_, t_, coef_, i, count_);
+	}
+
+	//
+	SIMD_TARGET_AVX2 void SlerpAVX2(Quaternion* result_, const Quaternion* from_, const Quaternion* to_, const float t_,
+		const SlerpCoefficients& coef_, const size_t count_)
+	{
+		const __m256 sign_mask = _mm256_set1_ps(-0.0f);
+		const __m256 one = _mm256_set1_ps(1.0f);
+		size_t i{ 0 };
+		for (; i + 8 <= count_; i += 8)
+		{
+			__m256 ax = LoadPairAVX2(from_ + i), ay = LoadPairAVX2(from_ + i + 1);
+			__m256 az = LoadPairAVX2(from_ + i + 2), aw = LoadPairAVX2(from_ + i + 3);
+			__m256 bx = LoadPairAVX2(to_ + i), by = LoadPairAVX2(to_ + i + 1);
+			__m256 bz = LoadPairAVX2(to_ + i + 2), bw = LoadPairAVX2(to_ + i + 3);
+			TransposeAVX2(ax, ay, az, aw);
+			TransposeAVX2(bx, by, bz, bw);
+
+			const __m256 dot = _mm256_fmadd_ps(ax, bx, _mm256_fmadd_ps(ay, by, _mm256_fmadd_ps(az, bz, _mm256_mul_ps(aw, bw))));
+			const __m256 sign = _mm256_and_ps(dot, sign_mask);
+			const __m256 xm1 = _mm256_sub_ps(_mm256_andnot_ps(sign_mask, dot), one);
+
+			__m256 w_from = one, w_to = one;
+			for (size_t k{ SLERP_TERMS }; k-- > 0;)
+			{
+				w_from = _mm256_fmadd_ps(_mm256_mul_ps(_mm256_set1_ps(coef_.from[k]), xm1), w_from, one);
+				w_to = _mm256_fmadd_ps(_mm256_mul_ps(_mm256_set1_ps(coef_.to[k]), xm1), w_to, one);
+			}
+			w_from = _mm256_mul_ps(w_from, _mm256_set1_ps(1.0f - t_));
+			w_to = _mm256_xor_ps(_mm256_mul_ps(w_to, _mm256_set1_ps(t_)), sign);
+
+			__m256 rx = _mm256_fmadd_ps(w_from, ax, _mm256_mul_ps(w_to, bx));
+			__m256 ry = _mm256_fmadd_ps(w_from, ay, _mm256_mul_ps(w_to, by));
+			__m256 rz = _mm256_fmadd_ps(w_from, az, _mm256_mul_ps(w_to, bz));
+			__m256 rw = _mm256_fmadd_ps(w_from, aw, _mm256_mul_ps(w_to, bw));
+
+			TransposeAVX2(rx, ry, rz, rw);
+			StorePairAVX2(result_ + i, rx); StorePairAVX2(result_ + i + 1, ry);
+			StorePairAVX2(result_ + i + 2, rz); StorePairAVX2(result_ + i + 3, rw);
+		}
+		SlerpScalar(result_, from_, to_, t_, coef_, i, count_);
+	}
+	#endif
+}
+
+//
+Quaternion QuatNlerp(const Quaternion& from_, const Quaternion& to_, const float t_)
+{
+	const float w_from = 1.0f - t_;
+	const float w_to = QuatDotProduct(from_, to_) < 0 ? -t_ : t_;
+	return QuatNormalize(
+	{
+		w_from * from_.x + w_to * to_.x, w_from * from_.y + w_to * to_.y,
+		w_from * from_.z + w_to * to_.z, w_from * from_.w + w_to * to_.w
+	});
+}
+
+//
+Quaternion QuatSlerp(const Quaternion& from_, const Quaternion& to_, const float t_)
+{
+	float dot = QuatDotProduct(from_, to_);
+	const float sign = dot < 0 ? -1.0f : 1.0f;
+	dot *= sign;
+
+	// sin(theta) -> 0, the weights below lose all precision
+	if (dot > 1.0f - QUAT_EPSILON)
+	{ return QuatNlerp(from_, to_, t_); }
+
+	const float theta = acosf(dot);
+	const float inv_sin = 1.0f / sinf(theta);
+	const float w_from = sinf((1.0f - t_) * theta) * inv_sin;
+	const float w_to = sinf(t_ * theta) * inv_sin * sign;
+	return
+	{
+		w_from * from_.x + w_to * to_.x, w_from * from_.y + w_to * to_.y,
+		w_from * from_.z + w_to * to_.z, w_from * from_.w + w_to * to_.w
+	};
+}
+
+//
+Matrix4x4 Mtx44FromQuat(const Quaternion& quat_)
+{
+	const float xx = quat_.x * quat_.x, yy = quat_.y * quat_.y, zz = quat_.z * quat_.z;
+	const float xy = quat_.x * quat_.y, xz = quat_.x * quat_.z, yz = quat_.y * quat_.z;
+	const float wx = quat_.w * quat_.x, wy = quat_.w * quat_.y, wz = quat_.w * quat_.z;
+	return
+	{
+		1 - 2 * (yy + zz), 2 * (xy - wz), 2 * (xz + wy), 0,
+		2 * (xy + wz), 1 - 2 * (xx + zz), 2 * (yz - wx), 0,
+		2 * (xz - wy), 2 * (yz + wx), 1 - 2 * (xx + yy), 0,
+		0, 0, 0, 1
+	};
+}
+
+//
+Quaternion QuatFromMtx44(const Matrix4x4& mtx_)
+{
+	// Shepperd: divide by the largest of the four candidates so it never nears 0
+	const float trace = mtx_.a00 + mtx_.a11 + mtx_.a22;
+	if (trace > 0)
+	{
+		const float s = sqrtf(trace + 1.0f) * 2.0f;
+		return { (mtx_.a21 - mtx_.a12) / s, (mtx_.a02 - mtx_.a20) / s, (mtx_.a10 - mtx_.a01) / s, 0.25f * s };
+	}
+	if (mtx_.a00 > mtx_.a11 && mtx_.a00 > mtx_.a22)
+	{
+		const float s = sqrtf(1.0f + mtx_.a00 - mtx_.a11 - mtx_.a22) * 2.0f;
+		return { 0.25f * s, (mtx_.a01 + mtx_.a10) / s, (mtx_.a02 + mtx_.a20) / s, (mtx_.a21 - mtx_.a12) / s };
+	}
+	if (mtx_.a11 > mtx_.a22)
+	{
+		const float s = sqrtf(1.0f + mtx_.a11 - mtx_.a00 - mtx_.a22) * 2.0f;
+		return { (mtx_.a01 + mtx_.a10) / s, 0.25f * s, (mtx_.a12 + mtx_.a21) / s, (mtx_.a02 - mtx_.a20) / s };
+	}
+	const float s = sqrtf(1.0f + mtx_.a22 - mtx_.a00 - mtx_.a11) * 2.0f;
+	return { (mtx_.a02 + mtx_.a20) / s, (mtx_.a12 + mtx_.a21) / s, 0.25f * s, (mtx_.a10 - mtx_.a01) / s };
+}
+
+//
+void QuatNlerpBatch(Quaternion* result_, const Quaternion* from_, const Quaternion* to_, const float t_, const size_t count_)
+{
+	static_assert(sizeof(Quaternion) == 4 * sizeof(float), "Quaternion must be tightly packed");
+	switch (SIMDGetLevel())
+	{
+	#if SIMD_X86
+	case SIMDLevel::AVX2: NlerpAVX2(result_, from_, to_, t_, count_); break;
+	case SIMDLevel::SSE: NlerpSSE(result_, from_, to_, t_, count_); break;
+	#endif
+	default: NlerpScalar(result_, from_, to_, t_, 0, count_); break;
+	}
+}
+
+//
+void QuatSlerpBatch(Quaternion* result_, const Quaternion* from_, const Quaternion* to_, const float t_, const size_t count_)
+{
+	const SlerpCoefficients coef(t_);
+	switch (SIMDGetLevel())
+	{
+	#if SIMD_X86
+	case SIMDLevel::AVX2: SlerpAVX2(result_, from_, to_, t_, coef, count_); break;
+	case SIMDLevel::SSE: SlerpSSE(result_, from_, to_, t_, coef, count_); break;
+	#endif
+	default: SlerpScalar(result_, from_, to_, t_, coef, 0, count_); break;
+	}
+}
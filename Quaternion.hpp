@@ -0,0 +1,168 @@
+//
+#pragma once
+#ifndef QUATERNION_H_
+#define QUATERNION_H_
+
+#include "Matrix4x4.hpp"
+#include "Vector3D.hpp"
+#include <corecrt_math_defines.h> // M_PI
+
+constexpr float QUAT_EPSILON = 0.0001f;
+
+// x, y, z is the vector part, w the scalar part; rotations are unit quaternions
+typedef union Quaternion
+{
+	// some warning about a nameless struct
+	// but it's way more convenient this way :(
+	struct
+	{ float x, y, z, w; };
+
+	float m[4];
+
+	/* Constructors */
+
+	// identity rotation
+	constexpr Quaternion() : x{ 0.0f }, y{ 0.0f }, z{ 0.0f }, w{ 1.0f }
+	{ /* empty by design */ }
+
+	//
+	constexpr Quaternion(float x_, float y_, float z_, float w_) :
+	x{ x_ }, y{ y_ }, z{ z_ }, w{ w_ }
+	{ /* empty by design */ }
+
+	/* Assignment Operators */
+
+	// defaulted so the union stays trivially copyable
+	Quaternion& operator=(const Quaternion& rhs_) = default;
+
+	//
+	constexpr Quaternion& operator*=(const Quaternion& rhs_);
+
+	/* Others */
+
+	//
+	float Length() const
+	{ return sqrtf(LengthSq()); }
+
+	//
+	constexpr float LengthSq() const
+	{ return x * x + y * y + z * z + w * w; }
+
+	//
+	void Swap(Quaternion& rhs_)
+	{ std::swap((*this).m, rhs_.m); }
+
+} Quaternion, Quat;
+
+// Hamilton product, lhs_ applied after rhs_ (same order as Matrix4x4)
+constexpr Quaternion operator*(const Quaternion& lhs_, const Quaternion& rhs_)
+{
+	return
+	{
+		lhs_.w * rhs_.x + lhs_.x * rhs_.w + lhs_.y * rhs_.z - lhs_.z * rhs_.y,
+		lhs_.w * rhs_.y - lhs_.x * rhs_.z + lhs_.y * rhs_.w + lhs_.z * rhs_.x,
+		lhs_.w * rhs_.z + lhs_.x * rhs_.y - lhs_.y * rhs_.x + lhs_.z * rhs_.w,
+		lhs_.w * rhs_.w - lhs_.x * rhs_.x - lhs_.y * rhs_.y - lhs_.z * rhs_.z
+	};
+}
+
+// rotates vec_ by a unit quat_: v + 2w(q x v) + 2q x (q x v), 15 multiplies
+constexpr Vector3D operator*(const Quaternion& quat_, const Vector3D& vec_)
+{
+	const Vector3D q{ quat_.x, quat_.y, quat_.z };
+	const Vector3D t = 2.0f * Vector3DCrossProduct(q, vec_);
+	return vec_ + quat_.w * t + Vector3DCrossProduct(q, t);
+}
+
+//
+constexpr Quaternion& Quaternion::operator*=(const Quaternion& rhs_)
+{ return *this = *this * rhs_; }
+
+//
+constexpr float QuatDotProduct(const Quaternion& quat_0_, const Quaternion& quat_1_)
+{ return quat_0_.x * quat_1_.x + quat_0_.y * quat_1_.y + quat_0_.z * quat_1_.z + quat_0_.w * quat_1_.w; }
+
+// inverse of a unit quaternion
+constexpr Quaternion QuatConjugate(const Quaternion& quat_)
+{ return { -quat_.x, -quat_.y, -quat_.z, quat_.w }; }
+
+//
+inline Quaternion QuatNormalize(const Quaternion& quat_)
+{
+	const float magnitude = quat_.Length();
+	if (-QUAT_EPSILON <= magnitude && magnitude <= QUAT_EPSILON)
+	{ throw "Division by 0 in QuatNormalize()"; }
+	const float inv_magnitude = 1.0f / magnitude;
+	return { quat_.x * inv_magnitude, quat_.y * inv_magnitude, quat_.z * inv_magnitude, quat_.w * inv_magnitude };
+}
+
+// rsqrt + one Newton-Raphson step, good enough to renormalize drifted rotations
+inline Quaternion QuatNormalizeFast(const Quaternion& quat_)
+{
+	const float magnitude_sq = quat_.LengthSq();
+	if (magnitude_sq <= QUAT_EPSILON * QUAT_EPSILON)
+	{ throw "Division by 0 in QuatNormalizeFast()"; }
+	const float inv_magnitude = SIMDInvSqrtFast(magnitude_sq);
+	return { quat_.x * inv_magnitude, quat_.y * inv_magnitude, quat_.z * inv_magnitude, quat_.w * inv_magnitude };
+}
+
+// for any non-zero quaternion, not just unit ones
+inline Quaternion QuatInverse(const Quaternion& quat_)
+{
+	const float magnitude_sq = quat_.LengthSq();
+	if (magnitude_sq <= QUAT_EPSILON * QUAT_EPSILON)
+	{ throw "Division by 0 in QuatInverse()"; }
+	const float inv_magnitude_sq = 1.0f / magnitude_sq;
+	return { -quat_.x * inv_magnitude_sq, -quat_.y * inv_magnitude_sq, -quat_.z * inv_magnitude_sq, quat_.w * inv_magnitude_sq };
+}
+
+// axis_ does not need to be normalized, same rotation as Mtx44RotRad()
+inline Quaternion QuatRotRad(const Vector3D axis_, const float radians_)
+{
+	const Vector3D v = Vector3DNormalize(axis_) * sinf(radians_ * 0.5f);
+	return { v.x, v.y, v.z, cosf(radians_ * 0.5f) };
+}
+
+//
+inline Quaternion QuatRotDeg(const Vector3D axis_, const float degrees_)
+{ return QuatRotRad(axis_, static_cast<float>(degrees_ / 180.0f * M_PI)); }
+
+// one explicit Euler step of dq/dt = 0.5 * {omega, 0} * q followed by a
+// renormalize; angular_velocity_ is in world space, radians per second
+inline Quaternion QuatIntegrate(const Quaternion& quat_, const Vector3D& angular_velocity_, const float dt_)
+{
+	const float hx = angular_velocity_.x * dt_ * 0.5f;
+	const float hy = angular_velocity_.y * dt_ * 0.5f;
+	const float hz = angular_velocity_.z * dt_ * 0.5f;
+	return QuatNormalizeFast(
+	{
+		quat_.x + hx * quat_.w + hy * quat_.z - hz * quat_.y,
+		quat_.y + hy * quat_.w + hz * quat_.x - hx * quat_.z,
+		quat_.z + hz * quat_.w + hx * quat_.y - hy * quat_.x,
+		quat_.w - hx * quat_.x - hy * quat_.y - hz * quat_.z
+	});
+}
+
+// normalized lerp along the shorter arc, not constant speed but close for small angles
+Quaternion QuatNlerp(const Quaternion& from_, const Quaternion& to_, float t_);
+
+// spherical lerp along the shorter arc, falls back to QuatNlerp() when nearly parallel
+Quaternion QuatSlerp(const Quaternion& from_, const Quaternion& to_, float t_);
+
+// rotation part only, quat_ is expected to be of unit length
+Matrix4x4 Mtx44FromQuat(const Quaternion& quat_);
+
+// reads the upper 3x3 only, which must be a pure rotation (no scale or shear)
+Quaternion QuatFromMtx44(const Matrix4x4& mtx_);
+
+/* BATCH KERNELS */
+// these dispatch on SIMDGetLevel() and handle any count_; result_ may alias an input
+
+// result_[i] = QuatNlerp(from_[i], to_[i], t_)
+void QuatNlerpBatch(Quaternion* result_, const Quaternion* from_, const Quaternion* to_, float t_, size_t count_);
+
+// result_[i] ~ QuatSlerp(from_[i], to_[i], t_), branch-free polynomial
+// weights instead of acos/sin, within 2e-6 of QuatSlerp() for unit inputs
+void QuatSlerpBatch(Quaternion* result_, const Quaternion* from_, const Quaternion* to_, float t_, size_t count_);
+
+#endif // QUATERNION_H_
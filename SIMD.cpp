@@ -0,0 +1,111 @@
+//
+#include "SIMD.hpp"
+#include <new> // operator new(), std::align_val_t
+
+#if SIMD_X86
+#if defined(_MSC_VER)
+#include <intrin.h> // __cpuid(), __cpuidex()
+#else
+#include <cpuid.h> // __get_cpuid(), __get_cpuid_count()
+#endif
+#endif
+
+namespace
+{
+	//
+	void CPUID(int* regs_, const int leaf_, const int subleaf_)
+	{
+		#if SIMD_X86 && defined(_MSC_VER)
+		__cpuidex(regs_, leaf_, subleaf_);
+		#elif SIMD_X86
+		unsigned int a{ 0 }, b{ 0 }, c{ 0 }, d{ 0 };
+		__get_cpuid_count(static_cast<unsigned int>(leaf_), static_cast<unsigned int>(subleaf_), &a, &b, &c, &d);
+		regs_[0] = static_cast<int>(a); regs_[1] = static_cast<int>(b);
+		regs_[2] = static_cast<int>(c); regs_[3] = static_cast<int>(d);
+		#else
+		(void)leaf_;
+		(void)subleaf_;
+		regs_[0] = regs_[1] = regs_[2] = regs_[3] = 0;
+		#endif
+	}
+
+	// OS must save the ymm registers on context switch before AVX is usable
+	bool OSSavesYMM()
+	{
+		#if SIMD_X86 && defined(_MSC_VER)
+		return (_xgetbv(0) & 0x6) == 0x6;
+		#elif SIMD_X86
+		unsigned int eax{ 0 }, edx{ 0 };
+		__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+		return (eax & 0x6) == 0x6;
+		#else
+		return false;
+		#endif
+	}
+
+	//
+	SIMDLevel& CurrentLevel()
+	{
+		static SIMDLevel level = SIMDDetectLevel();
+		return level;
+	}
+}
+
+//
+SIMDLevel SIMDDetectLevel()
+{
+	static const SIMDLevel detected = []()
+	{
+		int regs[4]{};
+		CPUID(regs, 0, 0);
+		const int max_leaf = regs[0];
+		if (max_leaf < 1)
+		{ return SIMDLevel::Scalar; }
+
+		CPUID(regs, 1, 0);
+		const bool sse41 = (regs[2] & (1 << 19)) != 0;
+		const bool fma = (regs[2] & (1 << 12)) != 0;
+		const bool osxsave = (regs[2] & (1 << 27)) != 0;
+		const bool avx = (regs[2] & (1 << 28)) != 0;
+
+		bool avx2 = false;
+		if (max_leaf >= 7)
+		{
+			CPUID(regs, 7, 0);
+			avx2 = (regs[1] & (1 << 5)) != 0;
+		}
+
+		if (osxsave && avx && avx2 && fma && OSSavesYMM())
+		{ return SIMDLevel::AVX2; }
+		if (sse41)
+		{ return SIMDLevel::SSE; }
+		return SIMDLevel::Scalar;
+	}();
+	return detected;
+}
+
+//
+SIMDLevel SIMDGetLevel()
+{ return CurrentLevel(); }
+
+//
+void SIMDSetLevel(const SIMDLevel level_)
+{
+	const SIMDLevel supported = SIMDDetectLevel();
+	CurrentLevel() = static_cast<int>(level_) < static_cast<int>(supported) ? level_ : supported;
+}
+
+//
+size_t SIMDPaddedSize(const size_t size_)
+{ return (size_ + SIMD_WIDTH - 1) / SIMD_WIDTH * SIMD_WIDTH; }
+
+//
+void* SIMDAlignedAlloc(const size_t bytes_)
+{ return ::operator new(bytes_, std::align_val_t{ SIMD_ALIGNMENT }); }
+
+//
+void SIMDAlignedFree(void* ptr_)
+{
+	if (ptr_)
+	{ ::operator delete(ptr_, std::align_val_t{ SIMD_ALIGNMENT }); }
+}
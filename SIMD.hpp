@@ -0,0 +1,77 @@
+//
+#pragma once
+#ifndef SIMD_HPP_
+#define SIMD_HPP_
+
+#include <cmath> // sqrtf()
+#include <cstddef> // size_t
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define SIMD_X86 1
+#include <immintrin.h>
+#else
+#define SIMD_X86 0
+#endif
+
+// SSE2 is part of the x64 baseline, so non-dispatched code can use it directly
+#if defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SIMD_SSE2 1
+#else
+#define SIMD_SSE2 0
+#endif
+
+// MSVC lets any intrinsic through, gcc/clang need the function tagged
+#if SIMD_X86 && (defined(__GNUC__) || defined(__clang__))
+#define SIMD_TARGET_SSE __attribute__((target("sse4.1")))
+#define SIMD_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#else
+#define SIMD_TARGET_SSE
+#define SIMD_TARGET_AVX2
+#endif
+
+// widest lane count any kernel uses, streams are padded to a multiple of this
+static const size_t SIMD_WIDTH = 8;
+
+// alignment of stream storage, enough for an aligned 256-bit load
+static const size_t SIMD_ALIGNMENT = 32;
+
+//
+enum class SIMDLevel
+{
+	Scalar = 0,
+	SSE = 1, // SSE4.1
+	AVX2 = 2 // AVX2 + FMA
+};
+
+// best level this CPU and OS support, queried once via CPUID
+SIMDLevel SIMDDetectLevel();
+
+// level the batch kernels dispatch on, defaults to SIMDDetectLevel()
+SIMDLevel SIMDGetLevel();
+
+// clamped to what the CPU supports; lets benchmarks force the fallback paths
+void SIMDSetLevel(SIMDLevel level_);
+
+//
+size_t SIMDPaddedSize(size_t size_);
+
+//
+void* SIMDAlignedAlloc(size_t bytes_);
+
+//
+void SIMDAlignedFree(void* ptr_);
+
+// 1/sqrt(x_) from the hardware estimate (rsqrtss, ~12 bits) refined by one
+// Newton-Raphson step. Max relative error is 3.0e-7 over all normal floats,
+// i.e. ~2.5 ulp versus ~0.5 ulp for 1.0f / sqrtf(x_). 0 gives NaN, not inf.
+inline float SIMDInvSqrtFast(const float x_)
+{
+	#if SIMD_SSE2
+	const float y = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x_)));
+	return y * (1.5f - 0.5f * x_ * y * y);
+	#else
+	return 1.0f / sqrtf(x_);
+	#endif
+}
+
+#endif // SIMD_HPP_
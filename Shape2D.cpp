@@ -0,0 +1,429 @@
+//
+#include "Shape2D.hpp"
+#include <array> // std::array
+#include <utility> // std::index_sequence
+
+namespace
+{
+	constexpr size_t SHAPE_TYPES = static_cast<size_t>(ShapeType::Count);
+
+	//
+	constexpr size_t PairKey(const ShapeType type_0_, const ShapeType type_1_)
+	{ return static_cast<size_t>(type_0_) * SHAPE_TYPES + static_cast<size_t>(type_1_); }
+
+	// a LineSegment is a capsule of radius 0, VEC2_EPSILON so that the distance
+	// of two crossing segments still comes out inside it after rounding
+	Capsule2D SegmentCapsule(const LineSegment& segment_)
+	{ return { segment_.pt0, segment_.pt1, VEC2_EPSILON }; }
+
+	// every pair lands on one CDStatic_ function, those written for the other
+	// order swap their arguments. Pairs with no direct test go through the polygon
+	// or capsule versions
+	template <ShapeType A, ShapeType B>
+	bool ShapeTest(const Shape2D& shape_0_, const Shape2D& shape_1_)
+	{
+		if constexpr (A > B)
+		{ return ShapeTest<B, A>(shape_1_, shape_0_); }
+		else
+		{
+			constexpr size_t key = PairKey(A, B);
+			const Shape2D& a = shape_0_;
+			const Shape2D& b = shape_1_;
+			if constexpr (key == PairKey(ShapeType::Circle, ShapeType::Circle))
+			{ return CDStatic_CircleCircle(a.circle, b.circle); }
+			else if constexpr (key == PairKey(ShapeType::Circle, ShapeType::AABB))
+			{ return CDStatic_CircleRect(a.circle, b.aabb); }
+			else if constexpr (key == PairKey(ShapeType::Circle, ShapeType::LineSegment))
+			{ return CDStatic_CircleLineSegment(a.circle, b.segment); }
+			else if constexpr (key == PairKey(ShapeType::Circle, ShapeType::OBB))
+			{ return CDStatic_CircleOBB(a.circle, b.obb); }
+			else if constexpr (key == PairKey(ShapeType::Circle, ShapeType::Capsule))
+			{ return CDStatic_CircleCapsule(a.circle, b.capsule); }
+			else if constexpr (key == PairKey(ShapeType::Circle, ShapeType::Polygon))
+			{ return CDStatic_CirclePolygon(a.circle, *b.polygon); }
+			else if constexpr (key == PairKey(ShapeType::AABB, ShapeType::AABB))
+			{ return CDStatic_RectRect_AABB(a.aabb, b.aabb); }
+			else if constexpr (key == PairKey(ShapeType::AABB, ShapeType::LineSegment))
+			{ return CDStatic_CapsuleAABB(SegmentCapsule(b.segment), a.aabb); }
+			else if constexpr (key == PairKey(ShapeType::AABB, ShapeType::OBB))
+			{ return CDStatic_OBBAABB(b.obb, a.aabb); }
+			else if constexpr (key == PairKey(ShapeType::AABB, ShapeType::Capsule))
+			{ return CDStatic_CapsuleAABB(b.capsule, a.aabb); }
+			else if constexpr (key == PairKey(ShapeType::AABB, ShapeType::Polygon))
+			{ return CDStatic_PolygonPolygon(ConvexPolygon2D(a.aabb), *b.polygon); }
+			else if constexpr (key == PairKey(ShapeType::LineSegment, ShapeType::LineSegment))
+			{ return CDStatic_CapsuleLineSegment(SegmentCapsule(a.segment), b.segment); }
+			else if constexpr (key == PairKey(ShapeType::LineSegment, ShapeType::OBB))
+			{ return CDStatic_CapsulePolygon(SegmentCapsule(a.segment), ConvexPolygon2D(b.obb)); }
+			else if constexpr (key == PairKey(ShapeType::LineSegment, ShapeType::Capsule))
+			{ return CDStatic_CapsuleLineSegment(b.capsule, a.segment); }
+			else if constexpr (key == PairKey(ShapeType::LineSegment, ShapeType::Polygon))
+			{ return CDStatic_CapsulePolygon(SegmentCapsule(a.segment), *b.polygon); }
+			else if constexpr (key == PairKey(ShapeType::OBB, ShapeType::OBB))
+			{ return CDStatic_OBBOBB(a.obb, b.obb); }
+			else if constexpr (key == PairKey(ShapeType::OBB, ShapeType::Capsule))
+			{ return CDStatic_CapsulePolygon(b.capsule, ConvexPolygon2D(a.obb)); }
+			else if constexpr (key == PairKey(ShapeType::OBB, ShapeType::Polygon))
+			{ return CDStatic_PolygonPolygon(ConvexPolygon2D(a.obb), *b.polygon); }
+			else if constexpr (key == PairKey(ShapeType::Capsule, ShapeType::Capsule))
+			{ return CDStatic_CapsuleCapsule(a.capsule, b.capsule); }
+			else if constexpr (key == PairKey(ShapeType::Capsule, ShapeType::Polygon))
+			{ return CDStatic_CapsulePolygon(a.capsule, *b.polygon); }
+			else
+			{
+				static_assert(key == PairKey(ShapeType::Polygon, ShapeType::Polygon), "ShapeType pair without a test");
+				return CDStatic_PolygonPolygon(*a.polygon, *b.polygon);
+			}
+		}
+	}
+
+	using ShapeTestFn = bool (*)(const Shape2D&, const Shape2D&);
+
+	//
+	template <size_t... Keys>
+	constexpr std::array<ShapeTestFn, sizeof...(Keys)> MakeShapeTests(std::index_sequence<Keys...>)
+	{ return { &ShapeTest<static_cast<ShapeType>(Keys / SHAPE_TYPES), static_cast<ShapeType>(Keys % SHAPE_TYPES)>... }; }
+
+	// indexed by PairKey()
+	constexpr std::array<ShapeTestFn, SHAPE_TYPES * SHAPE_TYPES> SHAPE_TESTS =
+		MakeShapeTests(std::make_index_sequence<SHAPE_TYPES * SHAPE_TYPES>{});
+
+	//
+	void SetHit(uint8_t* hits_, const size_t i_, const bool hit_)
+	{ hits_[i_ / 8] |= static_cast<uint8_t>(hit_ << (i_ % 8)); }
+
+	/* SCALAR KERNELS */
+	// pairwise rather than one against many: lane i of every array belongs to pair i.
+	// Like the other kernels they take begin_ so the SIMD ones can use them for tails,
+	// and write one byte of hits_ per 8 pairs
+
+	//
+	void CircleCirclePairsScalar(uint8_t* hits_, const float* const (&a_)[6], size_t begin_, const size_t n_)
+	{
+		for (; begin_ < n_; ++begin_)
+		{
+			const float dx = a_[0][begin_] - a_[3][begin_], dy = a_[1][begin_] - a_[4][begin_];
+			const float radius = a_[2][begin_] + a_[5][begin_];
+			if (begin_ % 8 == 0)
+			{ hits_[begin_ / 8] = 0; }
+			SetHit(hits_, begin_, radius * radius > dx * dx + dy * dy);
+		}
+	}
+
+	//
+	void CircleAABBPairsScalar(uint8_t* hits_, const float* const (&a_)[7], size_t begin_, const size_t n_)
+	{
+		for (; begin_ < n_; ++begin_)
+		{
+			const float dx = a_[0][begin_] - fminf(fmaxf(a_[0][begin_], a_[3][begin_]), a_[5][begin_]);
+			const float dy = a_[1][begin_] - fminf(fmaxf(a_[1][begin_], a_[4][begin_]), a_[6][begin_]);
+			if (begin_ % 8 == 0)
+			{ hits_[begin_ / 8] = 0; }
+			SetHit(hits_, begin_, dx * dx + dy * dy <= a_[2][begin_] * a_[2][begin_]);
+		}
+	}
+
+	//
+	void AABBAABBPairsScalar(uint8_t* hits_, const float* const (&a_)[8], size_t begin_, const size_t n_)
+	{
+		for (; begin_ < n_; ++begin_)
+		{
+			const bool hit = a_[0][begin_] < a_[6][begin_] && a_[4][begin_] < a_[2][begin_] &&
+				a_[1][begin_] < a_[7][begin_] && a_[5][begin_] < a_[3][begin_];
+			if (begin_ % 8 == 0)
+			{ hits_[begin_ / 8] = 0; }
+			SetHit(hits_, begin_, hit);
+		}
+	}
+
+	#if SIMD_X86
+	/* SSE KERNELS */
+
+	//
+	SIMD_TARGET_SSE void CircleCirclePairsSSE(uint8_t* hits_, const float* const (&a_)[6], const size_t n_)
+	{
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			int mask[2];
+			for (size_t h{ 0 }; h < 2; ++h)
+			{
+				const size_t j = i + 4 * h;
+				const __m128 dx = _mm_sub_ps(_mm_loadu_ps(a_[0] + j), _mm_loadu_ps(a_[3] + j));
+				const __m128 dy = _mm_sub_ps(_mm_loadu_ps(a_[1] + j), _mm_loadu_ps(a_[4] + j));
+				const __m128 radius = _mm_add_ps(_mm_loadu_ps(a_[2] + j), _mm_loadu_ps(a_[5] + j));
+				const __m128 dist_sq = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+				mask[h] = _mm_movemask_ps(_mm_cmpgt_ps(_mm_mul_ps(radius, radius), dist_sq));
+			}
+			hits_[i / 8] = static_cast<uint8_t>(mask[0] | mask[1] << 4);
+		}
+		CircleCirclePairsScalar(hits_, a_, i, n_);
+	}
+
+	//
+	SIMD_TARGET_SSE void CircleAABBPairsSSE(uint8_t* hits_, const float* const (&a_)[7], const size_t n_)
+	{
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			int mask[2];
+			for (size_t h{ 0 }; h < 2; ++h)
+			{
+				const size_t j = i + 4 * h;
+				const __m128 cx = _mm_loadu_ps(a_[0] + j), cy = _mm_loadu_ps(a_[1] + j), radius = _mm_loadu_ps(a_[2] + j);
+				const __m128 dx = _mm_sub_ps(cx, _mm_min_ps(_mm_max_ps(cx, _mm_loadu_ps(a_[3] + j)), _mm_loadu_ps(a_[5] + j)));
+				const __m128 dy = _mm_sub_ps(cy, _mm_min_ps(_mm_max_ps(cy, _mm_loadu_ps(a_[4] + j)), _mm_loadu_ps(a_[6] + j)));
+				const __m128 dist_sq = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+				mask[h] = _mm_movemask_ps(_mm_cmple_ps(dist_sq, _mm_mul_ps(radius, radius)));
+			}
+			hits_[i / 8] = static_cast<uint8_t>(mask[0] | mask[1] << 4);
+		}
+		CircleAABBPairsScalar(hits_, a_, i, n_);
+	}
+
+	//
+	SIMD_TARGET_SSE void AABBAABBPairsSSE(uint8_t* hits_, const float* const (&a_)[8], const size_t n_)
+	{
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			int mask[2];
+			for (size_t h{ 0 }; h < 2; ++h)
+			{
+				const size_t j = i + 4 * h;
+				const __m128 x = _mm_and_ps(_mm_cmplt_ps(_mm_loadu_ps(a_[0] + j), _mm_loadu_ps(a_[6] + j)),
+					_mm_cmplt_ps(_mm_loadu_ps(a_[4] + j), _mm_loadu_ps(a_[2] + j)));
+				const __m128 y = _mm_and_ps(_mm_cmplt_ps(_mm_loadu_ps(a_[1] + j), _mm_loadu_ps(a_[7] + j)),
+					_mm_cmplt_ps(_mm_loadu_ps(a_[5] + j), _mm_loadu_ps(a_[3] + j)));
+				mask[h] = _mm_movemask_ps(_mm_and_ps(x, y));
+			}
+			hits_[i / 8] = static_cast<uint8_t>(mask[0] | mask[1] << 4);
+		}
+		AABBAABBPairsScalar(hits_, a_, i, n_);
+	}
+
+	/* AVX2 KERNELS */
+
+	//
+	SIMD_TARGET_AVX2 void CircleCirclePairsAVX2(uint8_t* hits_, const float* const (&a_)[6], const size_t n_)
+	{
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(a_[0] + i), _mm256_loadu_ps(a_[3] + i));
+			const __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(a_[1] + i), _mm256_loadu_ps(a_[4] + i));
+			const __m256 radius = _mm256_add_ps(_mm256_loadu_ps(a_[2] + i), _mm256_loadu_ps(a_[5] + i));
+			const __m256 dist_sq = _mm256_fmadd_ps(dx, dx, _mm256_mul_ps(dy, dy));
+			hits_[i / 8] = static_cast<uint8_t>(_mm256_movemask_ps(_mm256_cmp_ps(_mm256_mul_ps(radius, radius), dist_sq, _CMP_GT_OQ)));
+		}
+		CircleCirclePairsScalar(hits_, a_, i, n_);
+	}
+
+	//
+	SIMD_TARGET_AVX2 void CircleAABBPairsAVX2(uint8_t* hits_, const float* const (&a_)[7], const size_t n_)
+	{
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const __m256 cx = _mm256_loadu_ps(a_[0] + i), cy = _mm256_loadu_ps(a_[1] + i), radius = _mm256_loadu_ps(a_[2] + i);
+			const __m256 dx = _mm256_sub_ps(cx, _mm256_min_ps(_mm256_max_ps(cx, _mm256_loadu_ps(a_[3] + i)), _mm256_loadu_ps(a_[5] + i)));
+			const __m256 dy = _mm256_sub_ps(cy, _mm256_min_ps(_mm256_max_ps(cy, _mm256_loadu_ps(a_[4] + i)), _mm256_loadu_ps(a_[6] + i)));
+			const __m256 dist_sq = _mm256_fmadd_ps(dx, dx, _mm256_mul_ps(dy, dy));
+			hits_[i / 8] = static_cast<uint8_t>(_mm256_movemask_ps(_mm256_cmp_ps(dist_sq, _mm256_mul_ps(radius, radius), _CMP_LE_OQ)));
+		}
+		CircleAABBPairsScalar(hits_, a_, i, n_);
+	}
+
+	//
+	SIMD_TARGET_AVX2 void AABBAABBPairsAVX2(uint8_t* hits_, const float* const (&a_)[8], const size_t n_)
+	{
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const __m256 x = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(a_[0] + i), _mm256_loadu_ps(a_[6] + i), _CMP_LT_OQ),
+				_mm256_cmp_ps(_mm256_loadu_ps(a_[4] + i), _mm256_loadu_ps(a_[2] + i), _CMP_LT_OQ));
+			const __m256 y = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(a_[1] + i), _mm256_loadu_ps(a_[7] + i), _CMP_LT_OQ),
+				_mm256_cmp_ps(_mm256_loadu_ps(a_[5] + i), _mm256_loadu_ps(a_[3] + i), _CMP_LT_OQ));
+			hits_[i / 8] = static_cast<uint8_t>(_mm256_movemask_ps(_mm256_and_ps(x, y)));
+		}
+		AABBAABBPairsScalar(hits_, a_, i, n_);
+	}
+	#endif
+
+	/* BUCKETS */
+	// every pair in order_ has the bucket's type pair in one order or the other
+
+	// pairs are bucketed this many at a time, so the sort and the gathered fields fit on the stack
+	constexpr size_t CHUNK = 256;
+
+	// the bucket's first type first
+	template <ShapeType A>
+	void OrderedPair(const Shape2D* shapes_, const ShapePair& pair_, const Shape2D*& shape_0_, const Shape2D*& shape_1_)
+	{
+		const bool swap = shapes_[pair_.first].type != A;
+		shape_0_ = &shapes_[swap ? pair_.second : pair_.first];
+		shape_1_ = &shapes_[swap ? pair_.first : pair_.second];
+	}
+
+	// no SIMD kernel, but the test is known for the whole bucket so it inlines
+	template <ShapeType A, ShapeType B>
+	void RunBucket(uint8_t* hits_, const Shape2D* shapes_, const ShapePair* pairs_, const size_t* order_, const size_t count_)
+	{
+		for (size_t k{ 0 }; k < count_; ++k)
+		{
+			const Shape2D* shape_0;
+			const Shape2D* shape_1;
+			OrderedPair<A>(shapes_, pairs_[order_[k]], shape_0, shape_1);
+			SetHit(hits_, order_[k], ShapeTest<A, B>(*shape_0, *shape_1));
+		}
+	}
+
+	// gathers FIELDS floats per pair into structure-of-arrays, runs the pairwise kernel
+	// on them and scatters the bits back to the pairs' own positions. count_ is at most CHUNK
+	template <ShapeType A, size_t FIELDS, typename Gather, typename Kernel>
+	void RunGathered(uint8_t* hits_, const Shape2D* shapes_, const ShapePair* pairs_, const size_t* order_, const size_t count_,
+		Gather gather_, Kernel kernel_)
+	{
+		float block[FIELDS * CHUNK];
+		float* fields[FIELDS];
+		const float* inputs[FIELDS];
+		for (size_t f{ 0 }; f < FIELDS; ++f)
+		{ inputs[f] = fields[f] = block + f * CHUNK; }
+		for (size_t k{ 0 }; k < count_; ++k)
+		{
+			const Shape2D* shape_0;
+			const Shape2D* shape_1;
+			OrderedPair<A>(shapes_, pairs_[order_[k]], shape_0, shape_1);
+			gather_(fields, k, *shape_0, *shape_1);
+		}
+
+		// no need to zero it, the kernels write every byte they use in full, tails included
+		uint8_t bucket_hits[CHUNK / 8];
+		kernel_(bucket_hits, inputs, count_);
+		for (size_t k{ 0 }; k < count_; ++k)
+		{ SetHit(hits_, order_[k], (bucket_hits[k / 8] >> (k % 8)) & 1); }
+	}
+
+	//
+	template <>
+	void RunBucket<ShapeType::Circle, ShapeType::Circle>(uint8_t* hits_, const Shape2D* shapes_, const ShapePair* pairs_,
+		const size_t* order_, const size_t count_)
+	{
+		const auto gather = [](float* (&fields_)[6], const size_t k_, const Shape2D& a_, const Shape2D& b_)
+		{
+			fields_[0][k_] = a_.circle.center.x; fields_[1][k_] = a_.circle.center.y; fields_[2][k_] = a_.circle.radius;
+			fields_[3][k_] = b_.circle.center.x; fields_[4][k_] = b_.circle.center.y; fields_[5][k_] = b_.circle.radius;
+		};
+		const auto kernel = [](uint8_t* bucket_hits_, const float* const (&fields_)[6], const size_t n_)
+		{
+			switch (SIMDGetLevel())
+			{
+			#if SIMD_X86
+			case SIMDLevel::AVX2: CircleCirclePairsAVX2(bucket_hits_, fields_, n_); break;
+			case SIMDLevel::SSE: CircleCirclePairsSSE(bucket_hits_, fields_, n_); break;
+			#endif
+			default: CircleCirclePairsScalar(bucket_hits_, fields_, 0, n_); break;
+			}
+		};
+		RunGathered<ShapeType::Circle, 6>(hits_, shapes_, pairs_, order_, count_, gather, kernel);
+	}
+
+	//
+	template <>
+	void RunBucket<ShapeType::Circle, ShapeType::AABB>(uint8_t* hits_, const Shape2D* shapes_, const ShapePair* pairs_,
+		const size_t* order_, const size_t count_)
+	{
+		const auto gather = [](float* (&fields_)[7], const size_t k_, const Shape2D& a_, const Shape2D& b_)
+		{
+			fields_[0][k_] = a_.circle.center.x; fields_[1][k_] = a_.circle.center.y; fields_[2][k_] = a_.circle.radius;
+			fields_[3][k_] = b_.aabb.min.x; fields_[4][k_] = b_.aabb.min.y; fields_[5][k_] = b_.aabb.max.x; fields_[6][k_] = b_.aabb.max.y;
+		};
+		const auto kernel = [](uint8_t* bucket_hits_, const float* const (&fields_)[7], const size_t n_)
+		{
+			switch (SIMDGetLevel())
+			{
+			#if SIMD_X86
+			case SIMDLevel::AVX2: CircleAABBPairsAVX2(bucket_hits_, fields_, n_); break;
+			case SIMDLevel::SSE: CircleAABBPairsSSE(bucket_hits_, fields_, n_); break;
+			#endif
+			default: CircleAABBPairsScalar(bucket_hits_, fields_, 0, n_); break;
+			}
+		};
+		RunGathered<ShapeType::Circle, 7>(hits_, shapes_, pairs_, order_, count_, gather, kernel);
+	}
+
+	//
+	template <>
+	void RunBucket<ShapeType::AABB, ShapeType::AABB>(uint8_t* hits_, const Shape2D* shapes_, const ShapePair* pairs_,
+		const size_t* order_, const size_t count_)
+	{
+		const auto gather = [](float* (&fields_)[8], const size_t k_, const Shape2D& a_, const Shape2D& b_)
+		{
+			fields_[0][k_] = a_.aabb.min.x; fields_[1][k_] = a_.aabb.min.y; fields_[2][k_] = a_.aabb.max.x; fields_[3][k_] = a_.aabb.max.y;
+			fields_[4][k_] = b_.aabb.min.x; fields_[5][k_] = b_.aabb.min.y; fields_[6][k_] = b_.aabb.max.x; fields_[7][k_] = b_.aabb.max.y;
+		};
+		const auto kernel = [](uint8_t* bucket_hits_, const float* const (&fields_)[8], const size_t n_)
+		{
+			switch (SIMDGetLevel())
+			{
+			#if SIMD_X86
+			case SIMDLevel::AVX2: AABBAABBPairsAVX2(bucket_hits_, fields_, n_); break;
+			case SIMDLevel::SSE: AABBAABBPairsSSE(bucket_hits_, fields_, n_); break;
+			#endif
+			default: AABBAABBPairsScalar(bucket_hits_, fields_, 0, n_); break;
+			}
+		};
+		RunGathered<ShapeType::AABB, 8>(hits_, shapes_, pairs_, order_, count_, gather, kernel);
+	}
+
+	using BucketFn = void (*)(uint8_t*, const Shape2D*, const ShapePair*, const size_t*, size_t);
+
+	// only the A <= B half is ever used, the pairs are bucketed unordered
+	template <size_t... Keys>
+	constexpr std::array<BucketFn, sizeof...(Keys)> MakeBuckets(std::index_sequence<Keys...>)
+	{ return { &RunBucket<static_cast<ShapeType>(Keys / SHAPE_TYPES), static_cast<ShapeType>(Keys % SHAPE_TYPES)>... }; }
+
+	// indexed by PairKey()
+	constexpr std::array<BucketFn, SHAPE_TYPES * SHAPE_TYPES> BUCKETS =
+		MakeBuckets(std::make_index_sequence<SHAPE_TYPES * SHAPE_TYPES>{});
+}
+
+//
+bool CDStatic_ShapeShape(const Shape2D& shape_0_, const Shape2D& shape_1_)
+{ return SHAPE_TESTS[PairKey(shape_0_.type, shape_1_.type)](shape_0_, shape_1_); }
+
+//
+void CDStatic_ShapePairsBatch(uint8_t* hits_, const Shape2D* shapes_, const ShapePair* pairs_, const size_t count_)
+{
+	// counting sort of the pair indices by their unordered type pair, one chunk at a time
+	const auto key = [&](const ShapePair& pair_)
+	{
+		const ShapeType type_0 = shapes_[pair_.first].type, type_1 = shapes_[pair_.second].type;
+		return type_0 < type_1 ? PairKey(type_0, type_1) : PairKey(type_1, type_0);
+	};
+	for (size_t i{ 0 }; i < (count_ + 7) / 8; ++i)
+	{ hits_[i] = 0; }
+
+	size_t order[CHUNK];
+	for (size_t begin{ 0 }; begin < count_; begin += CHUNK)
+	{
+		const size_t end = count_ - begin > CHUNK ? begin + CHUNK : count_;
+		size_t offsets[SHAPE_TYPES * SHAPE_TYPES + 1]{};
+		for (size_t i{ begin }; i < end; ++i)
+		{ ++offsets[key(pairs_[i]) + 1]; }
+		for (size_t k{ 0 }; k < SHAPE_TYPES * SHAPE_TYPES; ++k)
+		{ offsets[k + 1] += offsets[k]; }
+
+		size_t next[SHAPE_TYPES * SHAPE_TYPES];
+		for (size_t k{ 0 }; k < SHAPE_TYPES * SHAPE_TYPES; ++k)
+		{ next[k] = offsets[k]; }
+		for (size_t i{ begin }; i < end; ++i)
+		{ order[next[key(pairs_[i])]++] = i; }
+
+		for (size_t k{ 0 }; k < SHAPE_TYPES * SHAPE_TYPES; ++k)
+		{
+			if (offsets[k + 1] > offsets[k])
+			{ BUCKETS[k](hits_, shapes_, pairs_, order + offsets[k], offsets[k + 1] - offsets[k]); }
+		}
+	}
+}
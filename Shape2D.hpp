@@ -0,0 +1,84 @@
+//
+#pragma once
+#ifndef SHAPE2D_HPP_
+#define SHAPE2D_HPP_
+
+#include "CollisionDetection.hpp"
+#include <cstdint> // uint8_t
+
+// in the order the dispatch table is laid out
+enum class ShapeType : uint8_t
+{
+	Circle,
+	AABB,
+	LineSegment,
+	OBB,
+	Capsule,
+	Polygon,
+	Count
+};
+
+// any one of the 2D primitives plus which one it is. Polygons are held by pointer
+// so the variant is a LineSegment plus the tag, the ConvexPolygon2D has to outlive it
+struct Shape2D
+{
+	ShapeType type;
+	union
+	{
+		Circle circle;
+		AABB aabb;
+		LineSegment segment;
+		OBB2D obb;
+		Capsule2D capsule;
+		const ConvexPolygon2D* polygon;
+	};
+
+	/* Constructors */
+	// implicit, so lists of shapes can be written straight from the primitives
+
+	//
+	Shape2D(const Circle& circle_) : type{ ShapeType::Circle }, circle{ circle_ }
+	{ /* empty by design */ }
+
+	//
+	Shape2D(const AABB& aabb_) : type{ ShapeType::AABB }, aabb{ aabb_ }
+	{ /* empty by design */ }
+
+	// stored as its AABB
+	Shape2D(const Rect& rect_) : type{ ShapeType::AABB }, aabb{ rect_ }
+	{ /* empty by design */ }
+
+	//
+	Shape2D(const LineSegment& segment_) : type{ ShapeType::LineSegment }, segment{ segment_ }
+	{ /* empty by design */ }
+
+	//
+	Shape2D(const OBB2D& obb_) : type{ ShapeType::OBB }, obb{ obb_ }
+	{ /* empty by design */ }
+
+	//
+	Shape2D(const Capsule2D& capsule_) : type{ ShapeType::Capsule }, capsule{ capsule_ }
+	{ /* empty by design */ }
+
+	//
+	Shape2D(const ConvexPolygon2D* polygon_) : type{ ShapeType::Polygon }, polygon{ polygon_ }
+	{ /* empty by design */ }
+};
+
+// indices into a Shape2D array
+struct ShapePair
+{
+	size_t first;
+	size_t second;
+};
+
+// overlap test for any two shapes through a constexpr ShapeType x ShapeType table of
+// the CDStatic_ functions, touching counts the same way as the function it lands on
+bool CDStatic_ShapeShape(const Shape2D& shape_0_, const Shape2D& shape_1_);
+
+// tests count_ pairs of shapes_. The pairs are bucketed by their (unordered) type pair
+// first and each bucket runs as one homogeneous batch, SIMD for circles and AABBs.
+// Same bitmask layout as CDStatic_RectRect_AABBBatch(), bit i is pairs_[i]
+void CDStatic_ShapePairsBatch(uint8_t* hits_, const Shape2D* shapes_, const ShapePair* pairs_, size_t count_);
+
+#endif // SHAPE2D_HPP_
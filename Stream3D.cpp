@@ -0,0 +1,258 @@
+//
+#include "Stream3D.hpp"
+#include <cstring> // memcpy(), memset()
+#include <utility> // std::swap()
+
+namespace
+{
+	// fields_ arrays of padded_ floats in one zeroed block, holding the first size_ of
+	// each of the fields_ arrays in old_, which are old_capacity_ apart
+	float* GrowBlock(const float* old_, const size_t fields_, const size_t size_, const size_t old_capacity_, const size_t padded_)
+	{
+		float* block = static_cast<float*>(SIMDAlignedAlloc(fields_ * padded_ * sizeof(float)));
+		memset(block, 0, fields_ * padded_ * sizeof(float));
+		for (size_t f{ 0 }; f < fields_ && size_; ++f)
+		{ memcpy(block + f * padded_, old_ + f * old_capacity_, size_ * sizeof(float)); }
+		return block;
+	}
+
+	// zeroes the first size_ of each of the fields_ arrays in block_, which are capacity_ apart,
+	// so a cleared stream's padding stays zero
+	void ClearBlock(float* block_, const size_t fields_, const size_t size_, const size_t capacity_)
+	{
+		for (size_t f{ 0 }; f < fields_ && size_; ++f)
+		{ memset(block_ + f * capacity_, 0, size_ * sizeof(float)); }
+	}
+}
+
+//
+SphereStream::SphereStream(const Sphere* pArr_, const size_t size_)
+{
+	Reserve(size_);
+	for (size_t i{ 0 }; i < size_; ++i)
+	{ Set(i, pArr_[i]); }
+	size = size_;
+}
+
+//
+SphereStream::SphereStream(const SphereStream& rhs_)
+{
+	Reserve(rhs_.size);
+	for (size_t f{ 0 }; f < 4 && rhs_.size; ++f)
+	{ memcpy(center_x + f * capacity, rhs_.center_x + f * rhs_.capacity, rhs_.size * sizeof(float)); }
+	size = rhs_.size;
+}
+
+//
+SphereStream::SphereStream(SphereStream&& rhs_) noexcept
+{ Swap(rhs_); }
+
+//
+SphereStream::~SphereStream()
+{ SIMDAlignedFree(center_x); }
+
+//
+SphereStream& SphereStream::operator=(SphereStream rhs_)
+{
+	// copy swap idiom
+	Swap(rhs_);
+	return *this;
+}
+
+//
+void SphereStream::Reserve(const size_t capacity_)
+{
+	if (capacity_ <= capacity)
+	{ return; }
+
+	const size_t padded = SIMDPaddedSize(capacity_);
+	float* block = GrowBlock(center_x, 4, size, capacity, padded);
+	SIMDAlignedFree(center_x);
+	center_x = block;
+	center_y = block + padded;
+	center_z = block + 2 * padded;
+	radius = block + 3 * padded;
+	capacity = padded;
+}
+
+//
+void SphereStream::PushBack(const Sphere& sphere_)
+{
+	if (size == capacity)
+	{ Reserve(capacity ? capacity * 2 : SIMD_WIDTH); }
+	Set(size++, sphere_);
+}
+
+//
+void SphereStream::Clear()
+{
+	ClearBlock(center_x, 4, size, capacity);
+	size = 0;
+}
+
+//
+void SphereStream::Swap(SphereStream& rhs_) noexcept
+{
+	std::swap(center_x, rhs_.center_x);
+	std::swap(center_y, rhs_.center_y);
+	std::swap(center_z, rhs_.center_z);
+	std::swap(radius, rhs_.radius);
+	std::swap(size, rhs_.size);
+	std::swap(capacity, rhs_.capacity);
+}
+
+//
+AABB3Stream::AABB3Stream(const AABB3* pArr_, const size_t size_)
+{
+	Reserve(size_);
+	for (size_t i{ 0 }; i < size_; ++i)
+	{ Set(i, pArr_[i]); }
+	size = size_;
+}
+
+//
+AABB3Stream::AABB3Stream(const AABB3Stream& rhs_)
+{
+	Reserve(rhs_.size);
+	for (size_t f{ 0 }; f < 6 && rhs_.size; ++f)
+	{ memcpy(min_x + f * capacity, rhs_.min_x + f * rhs_.capacity, rhs_.size * sizeof(float)); }
+	size = rhs_.size;
+}
+
+//
+AABB3Stream::AABB3Stream(AABB3Stream&& rhs_) noexcept
+{ Swap(rhs_); }
+
+//
+AABB3Stream::~AABB3Stream()
+{ SIMDAlignedFree(min_x); }
+
+//
+AABB3Stream& AABB3Stream::operator=(AABB3Stream rhs_)
+{
+	// copy swap idiom
+	Swap(rhs_);
+	return *this;
+}
+
+//
+void AABB3Stream::Reserve(const size_t capacity_)
+{
+	if (capacity_ <= capacity)
+	{ return; }
+
+	const size_t padded = SIMDPaddedSize(capacity_);
+	float* block = GrowBlock(min_x, 6, size, capacity, padded);
+	SIMDAlignedFree(min_x);
+	min_x = block;
+	min_y = block + padded;
+	min_z = block + 2 * padded;
+	max_x = block + 3 * padded;
+	max_y = block + 4 * padded;
+	max_z = block + 5 * padded;
+	capacity = padded;
+}
+
+//
+void AABB3Stream::PushBack(const AABB3& aabb_)
+{
+	if (size == capacity)
+	{ Reserve(capacity ? capacity * 2 : SIMD_WIDTH); }
+	Set(size++, aabb_);
+}
+
+//
+void AABB3Stream::Clear()
+{
+	ClearBlock(min_x, 6, size, capacity);
+	size = 0;
+}
+
+//
+void AABB3Stream::Swap(AABB3Stream& rhs_) noexcept
+{
+	std::swap(min_x, rhs_.min_x);
+	std::swap(min_y, rhs_.min_y);
+	std::swap(min_z, rhs_.min_z);
+	std::swap(max_x, rhs_.max_x);
+	std::swap(max_y, rhs_.max_y);
+	std::swap(max_z, rhs_.max_z);
+	std::swap(size, rhs_.size);
+	std::swap(capacity, rhs_.capacity);
+}
+
+//
+PlaneStream::PlaneStream(const Plane* pArr_, const size_t size_)
+{
+	Reserve(size_);
+	for (size_t i{ 0 }; i < size_; ++i)
+	{ Set(i, pArr_[i]); }
+	size = size_;
+}
+
+//
+PlaneStream::PlaneStream(const PlaneStream& rhs_)
+{
+	Reserve(rhs_.size);
+	for (size_t f{ 0 }; f < 4 && rhs_.size; ++f)
+	{ memcpy(normal_x + f * capacity, rhs_.normal_x + f * rhs_.capacity, rhs_.size * sizeof(float)); }
+	size = rhs_.size;
+}
+
+//
+PlaneStream::PlaneStream(PlaneStream&& rhs_) noexcept
+{ Swap(rhs_); }
+
+//
+PlaneStream::~PlaneStream()
+{ SIMDAlignedFree(normal_x); }
+
+//
+PlaneStream& PlaneStream::operator=(PlaneStream rhs_)
+{
+	// copy swap idiom
+	Swap(rhs_);
+	return *this;
+}
+
+//
+void PlaneStream::Reserve(const size_t capacity_)
+{
+	if (capacity_ <= capacity)
+	{ return; }
+
+	const size_t padded = SIMDPaddedSize(capacity_);
+	float* block = GrowBlock(normal_x, 4, size, capacity, padded);
+	SIMDAlignedFree(normal_x);
+	normal_x = block;
+	normal_y = block + padded;
+	normal_z = block + 2 * padded;
+	offset = block + 3 * padded;
+	capacity = padded;
+}
+
+//
+void PlaneStream::PushBack(const Plane& plane_)
+{
+	if (size == capacity)
+	{ Reserve(capacity ? capacity * 2 : SIMD_WIDTH); }
+	Set(size++, plane_);
+}
+
+//
+void PlaneStream::Clear()
+{
+	ClearBlock(normal_x, 4, size, capacity);
+	size = 0;
+}
+
+//
+void PlaneStream::Swap(PlaneStream& rhs_) noexcept
+{
+	std::swap(normal_x, rhs_.normal_x);
+	std::swap(normal_y, rhs_.normal_y);
+	std::swap(normal_z, rhs_.normal_z);
+	std::swap(offset, rhs_.offset);
+	std::swap(size, rhs_.size);
+	std::swap(capacity, rhs_.capacity);
+}
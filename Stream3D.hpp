@@ -0,0 +1,213 @@
+//
+#pragma once
+#ifndef STREAM3D_HPP_
+#define STREAM3D_HPP_
+
+#include "SIMD.hpp"
+#include "Types3D.hpp"
+
+// structure-of-arrays storage for the 3D primitives the batch tests run over.
+// Like Vec2Stream each keeps its arrays in one SIMD_ALIGNMENT aligned block,
+// zero padded to a multiple of SIMD_WIDTH
+
+//
+struct SphereStream
+{
+	float* center_x{ nullptr };
+	float* center_y{ nullptr };
+	float* center_z{ nullptr };
+	float* radius{ nullptr };
+
+	/* Constructors */
+
+	//
+	SphereStream() = default;
+
+	//
+	SphereStream(const Sphere* pArr_, size_t size_);
+
+	//
+	SphereStream(const SphereStream& rhs_);
+
+	//
+	SphereStream(SphereStream&& rhs_) noexcept;
+
+	//
+	~SphereStream();
+
+	/* Assignment Operators */
+
+	//
+	SphereStream& operator=(SphereStream rhs_);
+
+	/* Others */
+
+	//
+	size_t Size() const
+	{ return size; }
+
+	//
+	size_t Capacity() const
+	{ return capacity; }
+
+	//
+	Sphere Get(size_t i_) const
+	{ return { { center_x[i_], center_y[i_], center_z[i_] }, radius[i_] }; }
+
+	//
+	void Set(size_t i_, const Sphere& sphere_)
+	{ center_x[i_] = sphere_.center.x; center_y[i_] = sphere_.center.y; center_z[i_] = sphere_.center.z; radius[i_] = sphere_.radius; }
+
+	//
+	void Reserve(size_t capacity_);
+
+	//
+	void PushBack(const Sphere& sphere_);
+
+	//
+	void Clear();
+
+	//
+	void Swap(SphereStream& rhs_) noexcept;
+
+private:
+	size_t size{ 0 };
+	size_t capacity{ 0 };
+};
+
+//
+struct AABB3Stream
+{
+	float* min_x{ nullptr };
+	float* min_y{ nullptr };
+	float* min_z{ nullptr };
+	float* max_x{ nullptr };
+	float* max_y{ nullptr };
+	float* max_z{ nullptr };
+
+	/* Constructors */
+
+	//
+	AABB3Stream() = default;
+
+	//
+	AABB3Stream(const AABB3* pArr_, size_t size_);
+
+	//
+	AABB3Stream(const AABB3Stream& rhs_);
+
+	//
+	AABB3Stream(AABB3Stream&& rhs_) noexcept;
+
+	//
+	~AABB3Stream();
+
+	/* Assignment Operators */
+
+	//
+	AABB3Stream& operator=(AABB3Stream rhs_);
+
+	/* Others */
+
+	//
+	size_t Size() const
+	{ return size; }
+
+	//
+	size_t Capacity() const
+	{ return capacity; }
+
+	//
+	AABB3 Get(size_t i_) const
+	{ return { { min_x[i_], min_y[i_], min_z[i_] }, { max_x[i_], max_y[i_], max_z[i_] } }; }
+
+	//
+	void Set(size_t i_, const AABB3& aabb_)
+	{
+		min_x[i_] = aabb_.min.x; min_y[i_] = aabb_.min.y; min_z[i_] = aabb_.min.z;
+		max_x[i_] = aabb_.max.x; max_y[i_] = aabb_.max.y; max_z[i_] = aabb_.max.z;
+	}
+
+	//
+	void Reserve(size_t capacity_);
+
+	//
+	void PushBack(const AABB3& aabb_);
+
+	//
+	void Clear();
+
+	//
+	void Swap(AABB3Stream& rhs_) noexcept;
+
+private:
+	size_t size{ 0 };
+	size_t capacity{ 0 };
+};
+
+//
+struct PlaneStream
+{
+	float* normal_x{ nullptr };
+	float* normal_y{ nullptr };
+	float* normal_z{ nullptr };
+	float* offset{ nullptr };
+
+	/* Constructors */
+
+	//
+	PlaneStream() = default;
+
+	//
+	PlaneStream(const Plane* pArr_, size_t size_);
+
+	//
+	PlaneStream(const PlaneStream& rhs_);
+
+	//
+	PlaneStream(PlaneStream&& rhs_) noexcept;
+
+	//
+	~PlaneStream();
+
+	/* Assignment Operators */
+
+	//
+	PlaneStream& operator=(PlaneStream rhs_);
+
+	/* Others */
+
+	//
+	size_t Size() const
+	{ return size; }
+
+	//
+	size_t Capacity() const
+	{ return capacity; }
+
+	//
+	Plane Get(size_t i_) const
+	{ return { Vec3{ normal_x[i_], normal_y[i_], normal_z[i_] }, offset[i_] }; }
+
+	//
+	void Set(size_t i_, const Plane& plane_)
+	{ normal_x[i_] = plane_.normal.x; normal_y[i_] = plane_.normal.y; normal_z[i_] = plane_.normal.z; offset[i_] = plane_.offset; }
+
+	//
+	void Reserve(size_t capacity_);
+
+	//
+	void PushBack(const Plane& plane_);
+
+	//
+	void Clear();
+
+	//
+	void Swap(PlaneStream& rhs_) noexcept;
+
+private:
+	size_t size{ 0 };
+	size_t capacity{ 0 };
+};
+
+#endif // STREAM3D_HPP_
@@ -0,0 +1,132 @@
+//
+#include "Transform2D.hpp"
+#include "SIMD.hpp"
+
+namespace
+{
+	//
+	void SinCosScalar(Rot2* result_, const float* radians_, size_t begin_, const size_t count_)
+	{
+		for (; begin_ < count_; ++begin_)
+		{ result_[begin_] = Rot2RotRad(radians_[begin_]); }
+	}
+
+	// Cephes sincosf: reduce to [-pi/4, pi/4] by octant j, evaluate both
+	// minimax polynomials, then swap and negate per octant. The three-part
+	// pi/4 keeps the reduction exact enough up to |x| ~ 8192.
+	constexpr float FOUR_OVER_PI = 1.27323954473516f;
+	constexpr float DP1 = -0.78515625f;
+	constexpr float DP2 = -2.4187564849853515625e-4f;
+	constexpr float DP3 = -3.77489497744594108e-8f;
+	constexpr float COS_P0 = 2.443315711809948e-5f;
+	constexpr float COS_P1 = -1.388731625493765e-3f;
+	constexpr float COS_P2 = 4.166664568298827e-2f;
+	constexpr float SIN_P0 = -1.9515295891e-4f;
+	constexpr float SIN_P1 = 8.3321608736e-3f;
+	constexpr float SIN_P2 = -1.6666654611e-1f;
+
+	#if SIMD_X86
+	//
+	SIMD_TARGET_SSE void SinCosSSE(Rot2* result_, const float* radians_, const size_t count_)
+	{
+		const __m128 sign_mask = _mm_set1_ps(-0.0f);
+		size_t i{ 0 };
+		for (; i + 4 <= count_; i += 4)
+		{
+			__m128 x = _mm_loadu_ps(radians_ + i);
+			__m128 sign_sin = _mm_and_ps(x, sign_mask);
+			x = _mm_andnot_ps(sign_mask, x);
+
+			// octant, rounded up to even
+			__m128i j = _mm_cvttps_epi32(_mm_mul_ps(x, _mm_set1_ps(FOUR_OVER_PI)));
+			j = _mm_and_si128(_mm_add_epi32(j, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+			const __m128 y = _mm_cvtepi32_ps(j);
+
+			sign_sin = _mm_xor_ps(sign_sin, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(j, _mm_set1_epi32(4)), 29)));
+			const __m128 sign_cos = _mm_castsi128_ps(_mm_slli_epi32(
+				_mm_andnot_si128(_mm_sub_epi32(j, _mm_set1_epi32(2)), _mm_set1_epi32(4)), 29));
+			const __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(j, _mm_set1_epi32(2)), _mm_set1_epi32(2)));
+
+			x = _mm_add_ps(x, _mm_mul_ps(y, _mm_set1_ps(DP1)));
+			x = _mm_add_ps(x, _mm_mul_ps(y, _mm_set1_ps(DP2)));
+			x = _mm_add_ps(x, _mm_mul_ps(y, _mm_set1_ps(DP3)));
+			const __m128 z = _mm_mul_ps(x, x);
+
+			__m128 pc = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(COS_P0), z), _mm_set1_ps(COS_P1));
+			pc = _mm_add_ps(_mm_mul_ps(pc, z), _mm_set1_ps(COS_P2));
+			pc = _mm_sub_ps(_mm_mul_ps(pc, _mm_mul_ps(z, z)), _mm_mul_ps(z, _mm_set1_ps(0.5f)));
+			pc = _mm_add_ps(pc, _mm_set1_ps(1.0f));
+
+			__m128 ps = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(SIN_P0), z), _mm_set1_ps(SIN_P1));
+			ps = _mm_add_ps(_mm_mul_ps(ps, z), _mm_set1_ps(SIN_P2));
+			ps = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(ps, z), x), x);
+
+			const __m128 s = _mm_xor_ps(_mm_blendv_ps(ps, pc, swap), sign_sin);
+			const __m128 c = _mm_xor_ps(_mm_blendv_ps(pc, ps, swap), sign_cos);
+			_mm_storeu_ps(&result_[i].c, _mm_unpacklo_ps(c, s));
+			_mm_storeu_ps(&result_[i + 2].c, _mm_unpackhi_ps(c, s));
+		}
+		SinCosScalar(result_, radians_, i, count_);
+	}
+
+	// same as SinCosSSE() eight at a time
+	SIMD_TARGET_AVX2 void SinCosAVX2(Rot2* result_, const float* radians_, const size_t count_)
+	{
+		const __m256 sign_mask = _mm256_set1_ps(-0.0f);
+		size_t i{ 0 };
+		for (; i + 8 <= count_; i += 8)
+		{
+			__m256 x = _mm256_loadu_ps(radians_ + i);
+			__m256 sign_sin = _mm256_and_ps(x, sign_mask);
+			x = _mm256_andnot_ps(sign_mask, x);
+
+			__m256i j = _mm256_cvttps_epi32(_mm256_mul_ps(x, _mm256_set1_ps(FOUR_OVER_PI)));
+			j = _mm256_and_si256(_mm256_add_epi32(j, _mm256_set1_epi32(1)), _mm256_set1_epi32(~1));
+			const __m256 y = _mm256_cvtepi32_ps(j);
+
+			sign_sin = _mm256_xor_ps(sign_sin, _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(j, _mm256_set1_epi32(4)), 29)));
+			const __m256 sign_cos = _mm256_castsi256_ps(_mm256_slli_epi32(
+				_mm256_andnot_si256(_mm256_sub_epi32(j, _mm256_set1_epi32(2)), _mm256_set1_epi32(4)), 29));
+			const __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(j, _mm256_set1_epi32(2)), _mm256_set1_epi32(2)));
+
+			x = _mm256_fmadd_ps(y, _mm256_set1_ps(DP1), x);
+			x = _mm256_fmadd_ps(y, _mm256_set1_ps(DP2), x);
+			x = _mm256_fmadd_ps(y, _mm256_set1_ps(DP3), x);
+			const __m256 z = _mm256_mul_ps(x, x);
+
+			__m256 pc = _mm256_fmadd_ps(_mm256_set1_ps(COS_P0), z, _mm256_set1_ps(COS_P1));
+			pc = _mm256_fmadd_ps(pc, z, _mm256_set1_ps(COS_P2));
+			pc = _mm256_fmsub_ps(pc, _mm256_mul_ps(z, z), _mm256_mul_ps(z, _mm256_set1_ps(0.5f)));
+			pc = _mm256_add_ps(pc, _mm256_set1_ps(1.0f));
+
+			__m256 ps = _mm256_fmadd_ps(_mm256_set1_ps(SIN_P0), z, _mm256_set1_ps(SIN_P1));
+			ps = _mm256_fmadd_ps(ps, z, _mm256_set1_ps(SIN_P2));
+			ps = _mm256_fmadd_ps(_mm256_mul_ps(ps, z), x, x);
+
+			const __m256 s = _mm256_xor_ps(_mm256_blendv_ps(ps, pc, swap), sign_sin);
+			const __m256 c = _mm256_xor_ps(_mm256_blendv_ps(pc, ps, swap), sign_cos);
+
+			// unpack interleaves within 128-bit lanes, the permutes put the lanes back in order
+			const __m256 lo = _mm256_unpacklo_ps(c, s);
+			const __m256 hi = _mm256_unpackhi_ps(c, s);
+			_mm256_storeu_ps(&result_[i].c, _mm256_permute2f128_ps(lo, hi, 0x20));
+			_mm256_storeu_ps(&result_[i + 4].c, _mm256_permute2f128_ps(lo, hi, 0x31));
+		}
+		SinCosScalar(result_, radians_, i, count_);
+	}
+	#endif
+}
+
+//
+void Rot2RotRadBatch(Rot2* result_, const float* radians_, const size_t count_)
+{
+	static_assert(sizeof(Rot2) == 2 * sizeof(float), "Rot2 must be tightly packed");
+	switch (SIMDGetLevel())
+	{
+	#if SIMD_X86
+	case SIMDLevel::AVX2: SinCosAVX2(result_, radians_, count_); break;
+	case SIMDLevel::SSE: SinCosSSE(result_, radians_, count_); break;
+	#endif
+	default: SinCosScalar(result_, radians_, 0, count_); break;
+	}
+}
@@ -0,0 +1,120 @@
+//
+#pragma once
+#ifndef TRANSFORM2D_H_
+#define TRANSFORM2D_H_
+
+#include "Matrix3x3.hpp"
+#include "Vector2D.hpp"
+
+// rotation stored as {cos, sin}, i.e. a unit complex number; composing two
+// is 4 multiplies instead of the 27 of a Matrix3x3 product
+struct Rot2
+{
+	float c{ 1.0f };
+	float s{ 0.0f };
+
+	/* Constructors */
+
+	//
+	constexpr Rot2()
+	{ /* empty by design */ }
+
+	// c_ and s_ are taken as is, they are expected to be of unit length
+	constexpr Rot2(float c_, float s_) : c{ c_ }, s{ s_ }
+	{ /* empty by design */ }
+
+	/* Others */
+
+	// in radians, within [-pi, pi]
+	float Angle() const
+	{ return atan2f(s, c); }
+};
+
+// lhs_ applied after rhs_
+constexpr Rot2 operator*(const Rot2& lhs_, const Rot2& rhs_)
+{ return { lhs_.c * rhs_.c - lhs_.s * rhs_.s, lhs_.s * rhs_.c + lhs_.c * rhs_.s }; }
+
+//
+constexpr Vector2D operator*(const Rot2& rot_, const Vector2D& vec_)
+{ return { rot_.c * vec_.x - rot_.s * vec_.y, rot_.s * vec_.x + rot_.c * vec_.y }; }
+
+// transpose, exact for a unit rotation
+constexpr Rot2 Rot2Inverse(const Rot2& rot_)
+{ return { rot_.c, -rot_.s }; }
+
+// rotates by -rot_ without building the inverse
+constexpr Vector2D Rot2InverseRotate(const Rot2& rot_, const Vector2D& vec_)
+{ return { rot_.c * vec_.x + rot_.s * vec_.y, rot_.c * vec_.y - rot_.s * vec_.x }; }
+
+//
+inline Rot2 Rot2RotRad(const float radians_)
+{ return { cosf(radians_), sinf(radians_) }; }
+
+//
+inline Rot2 Rot2RotDeg(const float degrees_)
+{ return Rot2RotRad(static_cast<float>(degrees_ / 180.0f * M_PI)); }
+
+// brings a rotation that drifted after many compositions back to unit length
+inline Rot2 Rot2Normalize(const Rot2& rot_)
+{
+	const float inv_magnitude = 1.0f / sqrtf(rot_.c * rot_.c + rot_.s * rot_.s);
+	return { rot_.c * inv_magnitude, rot_.s * inv_magnitude };
+}
+
+// result_[i] = Rot2RotRad(radians_[i]), SIMD sincos dispatched on SIMDGetLevel().
+// Within 2e-7 of cosf()/sinf() for |radians_| < 8192, result_ holds count_ Rot2
+void Rot2RotRadBatch(Rot2* result_, const float* radians_, size_t count_);
+
+// rigid 2D transform: rotate by rot, then translate by pos
+struct Transform2D
+{
+	Pt2 pos;
+	Rot2 rot;
+
+	/* Constructors */
+
+	//
+	constexpr Transform2D()
+	{ /* empty by design */ }
+
+	//
+	constexpr Transform2D(const Pt2 pos_, const Rot2 rot_) : pos{ pos_ }, rot{ rot_ }
+	{ /* empty by design */ }
+
+	//
+	Transform2D(const Pt2 pos_, const float radians_) : pos{ pos_ }, rot{ Rot2RotRad(radians_) }
+	{ /* empty by design */ }
+};
+
+// lhs_ applied after rhs_, same order as Matrix3x3
+constexpr Transform2D operator*(const Transform2D& lhs_, const Transform2D& rhs_)
+{ return { lhs_.rot * rhs_.pos + lhs_.pos, lhs_.rot * rhs_.rot }; }
+
+// point transform, translation applied
+constexpr Vector2D operator*(const Transform2D& xform_, const Vector2D& rhs_)
+{ return xform_.rot * rhs_ + xform_.pos; }
+
+// direction transform, translation ignored
+constexpr Vector2D Transform2DTransformVector(const Transform2D& xform_, const Vector2D& vec_)
+{ return xform_.rot * vec_; }
+
+//
+constexpr Transform2D Transform2DInverse(const Transform2D& xform_)
+{ return { -Rot2InverseRotate(xform_.rot, xform_.pos), Rot2Inverse(xform_.rot) }; }
+
+// same as Transform2DInverse(xform_) * pt_ without building the inverse
+constexpr Vector2D Transform2DInverseTransform(const Transform2D& xform_, const Vector2D& pt_)
+{ return Rot2InverseRotate(xform_.rot, pt_ - xform_.pos); }
+
+//
+inline Matrix3x3 Mtx33FromTransform2D(const Transform2D& xform_)
+{
+	return
+	{
+		xform_.rot.c, -xform_.rot.s, xform_.pos.x,
+		xform_.rot.s, xform_.rot.c, xform_.pos.y,
+		0, 0, 1
+	};
+}
+
+#endif // TRANSFORM2D_H_
@@ -0,0 +1,237 @@
+//
+#include "TriangleMesh.hpp"
+
+#include <algorithm> // std::partition(), std::nth_element()
+#include <cfloat> // FLT_MAX
+
+namespace
+{
+	// centroid bins per axis the SAH split is chosen from
+	constexpr size_t BINS = 16;
+
+	// past this depth splits fall back to the median, which halves the count every level.
+	// With at most 2^32 triangles no leaf is deeper than 48 + 32, and a traversal pushes
+	// at most 3 more nodes than it pops per level, which is what MAX_STACK allows for
+	constexpr size_t MAX_SAH_DEPTH = 48;
+
+	//
+	AABB3 EmptyBounds()
+	{ return { { FLT_MAX, FLT_MAX, FLT_MAX }, { -FLT_MAX, -FLT_MAX, -FLT_MAX } }; }
+
+	//
+	void Grow(AABB3& aabb_, const AABB3& rhs_)
+	{
+		for (size_t i{ 0 }; i < 3; ++i)
+		{
+			aabb_.min.m[i] = rhs_.min.m[i] < aabb_.min.m[i] ? rhs_.min.m[i] : aabb_.min.m[i];
+			aabb_.max.m[i] = rhs_.max.m[i] > aabb_.max.m[i] ? rhs_.max.m[i] : aabb_.max.m[i];
+		}
+	}
+
+	//
+	void Grow(AABB3& aabb_, const Pt3& pt_)
+	{ Grow(aabb_, { pt_, pt_ }); }
+
+	// half the surface area, which is all the SAH needs. 0 for an empty box
+	float HalfArea(const AABB3& aabb_)
+	{
+		const Vec3 size = aabb_.max - aabb_.min;
+		return size.x < 0 ? 0 : size.x * size.y + size.y * size.z + size.z * size.x;
+	}
+
+	// the binary tree the SAH builds, collapsed into BVHNode3D afterwards. count is 0 for an inner node
+	struct BuildNode
+	{
+		AABB3 bounds;
+		uint32_t left, right;
+		uint32_t first, count;
+	};
+
+	//
+	struct Builder
+	{
+		const std::vector<AABB3>& boxes;
+		const std::vector<Pt3>& centroids;
+		std::vector<uint32_t>& order;
+		std::vector<BuildNode> nodes;
+
+		// the bin of triangle_ along axis_, the same for choosing the split and partitioning on it
+		size_t Bin(const uint32_t triangle_, const size_t axis_, const float min_, const float scale_) const
+		{
+			const size_t bin = static_cast<size_t>((centroids[triangle_].m[axis_] - min_) * scale_);
+			return bin < BINS ? bin : BINS - 1;
+		}
+
+		// order_[first_, first_ + count_) into a subtree, returns its root
+		uint32_t Build(const uint32_t first_, const uint32_t count_, const size_t depth_)
+		{
+			AABB3 bounds = EmptyBounds(), centroid_bounds = EmptyBounds();
+			for (uint32_t i{ first_ }; i < first_ + count_; ++i)
+			{
+				Grow(bounds, boxes[order[i]]);
+				Grow(centroid_bounds, centroids[order[i]]);
+			}
+			const uint32_t index = static_cast<uint32_t>(nodes.size());
+			nodes.push_back({ bounds, 0, 0, first_, count_ });
+			if (count_ <= TriangleMesh::MAX_LEAF)
+			{ return index; }
+
+			const Vec3 extent = centroid_bounds.max - centroid_bounds.min;
+			const size_t widest = extent.x >= extent.y && extent.x >= extent.z ? 0 : (extent.y >= extent.z ? 1 : 2);
+			size_t best_axis{ 3 }, best_split{ 0 };
+			float best_cost{ FLT_MAX };
+			for (size_t axis{ 0 }; depth_ < MAX_SAH_DEPTH && axis < 3; ++axis)
+			{
+				if (extent.m[axis] <= 0)
+				{ continue; }
+				AABB3 bin_bounds[BINS];
+				uint32_t bin_count[BINS]{};
+				for (size_t b{ 0 }; b < BINS; ++b)
+				{ bin_bounds[b] = EmptyBounds(); }
+				const float min = centroid_bounds.min.m[axis], scale = BINS / extent.m[axis];
+				for (uint32_t i{ first_ }; i < first_ + count_; ++i)
+				{
+					const size_t b = Bin(order[i], axis, min, scale);
+					Grow(bin_bounds[b], boxes[order[i]]);
+					++bin_count[b];
+				}
+
+				// right_cost[s] is the right side of a split before bin s
+				float right_cost[BINS];
+				AABB3 side = EmptyBounds();
+				uint32_t side_count{ 0 };
+				for (size_t b{ BINS - 1 }; b > 0; --b)
+				{
+					Grow(side, bin_bounds[b]);
+					side_count += bin_count[b];
+					right_cost[b] = side_count ? HalfArea(side) * side_count : -1;
+				}
+				side = EmptyBounds();
+				side_count = 0;
+				for (size_t split{ 1 }; split < BINS; ++split)
+				{
+					Grow(side, bin_bounds[split - 1]);
+					side_count += bin_count[split - 1];
+					if (side_count == 0 || right_cost[split] < 0)
+					{ continue; }
+					const float cost = HalfArea(side) * side_count + right_cost[split];
+					if (cost < best_cost)
+					{ best_axis = axis; best_split = split; best_cost = cost; }
+				}
+			}
+
+			uint32_t* begin = order.data() + first_, * end = begin + count_, * mid;
+			if (best_axis < 3)
+			{
+				const float min = centroid_bounds.min.m[best_axis], scale = BINS / extent.m[best_axis];
+				mid = std::partition(begin, end, [&](const uint32_t triangle_)
+				{ return Bin(triangle_, best_axis, min, scale) < best_split; });
+			}
+			else
+			{
+				// too deep, or every centroid in one spot
+				mid = begin + count_ / 2;
+				std::nth_element(begin, mid, end, [&](const uint32_t lhs_, const uint32_t rhs_)
+				{ return centroids[lhs_].m[widest] < centroids[rhs_].m[widest]; });
+			}
+
+			const uint32_t left_count = static_cast<uint32_t>(mid - begin);
+			const uint32_t left = Build(first_, left_count, depth_ + 1);
+			const uint32_t right = Build(first_ + left_count, count_ - left_count, depth_ + 1);
+			nodes[index].left = left;
+			nodes[index].right = right;
+			nodes[index].count = 0;
+			return index;
+		}
+	};
+
+	// collapses the binary subtree at root_ into BVHNode3D, opening the largest inner
+	// child until there are 4. Returns the node's index
+	uint32_t Flatten(const std::vector<BuildNode>& build_, const uint32_t root_, std::vector<BVHNode3D>& nodes_)
+	{
+		uint32_t children[4]{ root_ };
+		size_t count{ 1 };
+		while (count < 4)
+		{
+			size_t best{ 4 };
+			float best_area{ -1 };
+			for (size_t i{ 0 }; i < count; ++i)
+			{
+				const BuildNode& child = build_[children[i]];
+				if (child.count == 0 && HalfArea(child.bounds) > best_area)
+				{ best = i; best_area = HalfArea(child.bounds); }
+			}
+			if (best == 4)
+			{ break; }
+			const BuildNode& opened = build_[children[best]];
+			children[best] = opened.left;
+			children[count++] = opened.right;
+		}
+
+		const uint32_t index = static_cast<uint32_t>(nodes_.size());
+		nodes_.push_back({});
+		nodes_[index].child_count = static_cast<uint32_t>(count);
+		for (size_t i{ 0 }; i < count; ++i)
+		{
+			const BuildNode& child = build_[children[i]];
+			// nodes_ grows under the recursion, so index it again afterwards
+			const uint32_t target = child.count ? child.first : Flatten(build_, children[i], nodes_);
+			BVHNode3D& node = nodes_[index];
+			node.min_x[i] = child.bounds.min.x;
+			node.min_y[i] = child.bounds.min.y;
+			node.min_z[i] = child.bounds.min.z;
+			node.max_x[i] = child.bounds.max.x;
+			node.max_y[i] = child.bounds.max.y;
+			node.max_z[i] = child.bounds.max.z;
+			node.child[i] = target;
+			node.leaf_count[i] = static_cast<uint8_t>(child.count);
+		}
+		return index;
+	}
+}
+
+//
+TriangleMesh::TriangleMesh(const Vector3D* vertices_, const size_t vertex_count_, const uint32_t* indices_,
+	const size_t triangle_count_) :
+	vertices(vertices_, vertices_ + vertex_count_), bounds{ EmptyBounds() }
+{
+	for (size_t i{ 0 }; i < 3 * triangle_count_; ++i)
+	{
+		if (indices_[i] >= vertex_count_)
+		{ throw "Index out of range in TriangleMesh()"; }
+	}
+	if (triangle_count_ == 0)
+	{
+		bounds = {};
+		return;
+	}
+
+	std::vector<AABB3> boxes(triangle_count_);
+	std::vector<Pt3> centroids(triangle_count_);
+	std::vector<uint32_t> order(triangle_count_);
+	for (size_t i{ 0 }; i < triangle_count_; ++i)
+	{
+		const Pt3& a = vertices_[indices_[3 * i]], & b = vertices_[indices_[3 * i + 1]], & c = vertices_[indices_[3 * i + 2]];
+		boxes[i] = { a, a };
+		Grow(boxes[i], b);
+		Grow(boxes[i], c);
+		Grow(bounds, boxes[i]);
+		centroids[i] = (boxes[i].min + boxes[i].max) * 0.5f;
+		order[i] = static_cast<uint32_t>(i);
+	}
+
+	Builder builder{ boxes, centroids, order, {} };
+	builder.nodes.reserve(2 * triangle_count_ / MAX_LEAF + 1);
+	builder.Build(0, static_cast<uint32_t>(triangle_count_), 0);
+	// Flatten() opens the root first, so a root that is a leaf ends up as the only child
+	nodes.reserve(builder.nodes.size() / 3 + 1);
+	Flatten(builder.nodes, 0, nodes);
+
+	indices.resize(3 * triangle_count_);
+	triangle_ids = order;
+	for (size_t i{ 0 }; i < triangle_count_; ++i)
+	{
+		for (size_t j{ 0 }; j < 3; ++j)
+		{ indices[3 * i + j] = indices_[3 * order[i] + j]; }
+	}
+}
@@ -0,0 +1,59 @@
+//
+#pragma once
+#ifndef TRIANGLE_MESH_HPP_
+#define TRIANGLE_MESH_HPP_
+
+#include "Types3D.hpp"
+#include <cstdint> // uint8_t, uint32_t
+#include <vector> // std::vector
+
+// 4 children of a BVH node, their boxes laid out like AABB3Stream so one SSE register
+// tests all 4 against a ray or a sphere. 128 bytes, two cache lines, and aligned to them
+struct alignas(64) BVHNode3D
+{
+	float min_x[4];
+	float min_y[4];
+	float min_z[4];
+	float max_x[4];
+	float max_y[4];
+	float max_z[4];
+	// a node index, or a leaf's first triangle if leaf_count is not 0
+	uint32_t child[4];
+	uint8_t leaf_count[4];
+	// children in use, always packed at the front
+	uint32_t child_count;
+	uint32_t padding;
+};
+
+// static triangle soup for level geometry. The constructor builds a 4-wide BVH over it with
+// binned SAH and reorders the triangles so every leaf is a contiguous run of them.
+// The queries are in CollisionDetection3D.hpp
+struct TriangleMesh
+{
+	// triangles per leaf at most
+	static constexpr size_t MAX_LEAF = 4;
+
+	// the deepest a query's traversal stack has to go, see TriangleMesh.cpp
+	static constexpr size_t MAX_STACK = 256;
+
+	std::vector<Vector3D> vertices;
+	// 3 vertex indices per triangle, in leaf order
+	std::vector<uint32_t> indices;
+	// what each triangle in leaf order was passed to the constructor as
+	std::vector<uint32_t> triangle_ids;
+	// nodes[0] is the root, empty for an empty mesh
+	std::vector<BVHNode3D> nodes;
+	AABB3 bounds{};
+
+	TriangleMesh() = default;
+	// indices_ holds 3 per triangle, throws if one is past vertex_count_
+	TriangleMesh(const Vector3D* vertices_, size_t vertex_count_, const uint32_t* indices_, size_t triangle_count_);
+	//
+	size_t TriangleCount() const
+	{ return triangle_ids.size(); }
+	// i_ in leaf order
+	void Triangle(size_t i_, Pt3& a_, Pt3& b_, Pt3& c_) const
+	{ a_ = vertices[indices[3 * i_]]; b_ = vertices[indices[3 * i_ + 1]]; c_ = vertices[indices[3 * i_ + 2]]; }
+};
+
+#endif // TRIANGLE_MESH_HPP_
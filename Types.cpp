@@ -1,31 +1,35 @@
 //
 #include "Types.hpp"
-#include "Matrix3x3.hpp"
+#include <algorithm> // std::reverse()
 
-LineSegment::LineSegment(Pt2 pos_, float scale_, float dir_)
+LineSegment::LineSegment(Pt2 pos_, float scale_, float dir_) :
+	LineSegment(Transform2D{ pos_, Rot2RotRad(dir_) }, scale_)
+{ /* empty by design */ }
+
+LineSegment::LineSegment(const Transform2D& xform_, const float scale_)
 {
-	Pt2 p0(0, 0), p1(0, 0);
-	Mtx33 rot = Mtx33RotRad(dir_);
-	// scale
-	p0.x -= scale_ / 2.0f;
-	p1.x += scale_ / 2.0f;
-	// rotate
-	p0 = rot * p0;
-	p1 = rot * p1;
-	// translate
-	p0 += pos_;
-	p1 += pos_;
-
-	// assignment of variables
-	pt0 = p0;
-	pt1 = p1;
-	const Vec2 vec = pt1 - pt0;
-	Vec2 normal_temp;
-	normal_temp.x = vec.y;
-	normal_temp.y = -vec.x;
-	normal = Vector2DNormalize(normal_temp);
+	if (-VEC2_EPSILON <= scale_ && scale_ <= VEC2_EPSILON)
+	{ throw "Division by 0 in LineSegment()"; }
+
+	// the rotated {scale / 2, 0} is just the rotor scaled, no matrix needed
+	const Vec2 half{ xform_.rot.c * scale_ / 2.0f, xform_.rot.s * scale_ / 2.0f };
+	pt0 = xform_.pos - half;
+	pt1 = xform_.pos + half;
+
+	// {vec.y, -vec.x} normalized, rot is already unit length
+	normal = scale_ < 0 ? Vec2{ -xform_.rot.s, xform_.rot.c } : Vec2{ xform_.rot.s, -xform_.rot.c };
 }
 
+Ray::Ray(const Pt2 pt_, const Vec2 dir_) : pt{ pt_ }, dir{ dir_ }
+{ /* empty by design */ }
+
+Ray::Ray(const Transform2D& xform_) : pt{ xform_.pos }, dir{ xform_.rot.c, xform_.rot.s }
+{ /* empty by design */ }
+
+Rect::Rect(const Pt2 center_, const float width_, const float height_) :
+	center{ center_ }, width{ width_ }, height{ height_ }
+{ /* empty by design */ }
+
 Rect::Rect(const AABB aabb)
 {
 	width = aabb.max.x - aabb.min.x;
@@ -34,6 +38,9 @@ Rect::Rect(const AABB aabb)
 	center.y = aabb.min.y + height / 2;
 }
 
+AABB::AABB(const Pt2 min_, const Pt2 max_) : min{ min_ }, max{ max_ }
+{ /* empty by design */ }
+
 AABB::AABB(const Rect rect)
 {
 	const Vec2 temp{ rect.width / 2,rect.height / 2 };
@@ -41,3 +48,83 @@ AABB::AABB(const Rect rect)
 	max = rect.center + temp;
 }
 
+
+OBB2D::OBB2D(const Pt2 center_, const Vec2 half_ext_, const Rot2 rot_) :
+	center{ center_ }, half_ext{ half_ext_ }, rot{ rot_ }
+{ /* empty by design */ }
+
+OBB2D::OBB2D(const Pt2 center_, const Vec2 half_ext_, const float dir_) :
+	OBB2D(center_, half_ext_, Rot2RotRad(dir_))
+{ /* empty by design */ }
+
+OBB2D::OBB2D(const AABB aabb_) :
+	center{ (aabb_.min + aabb_.max) * 0.5f }, half_ext{ (aabb_.max - aabb_.min) * 0.5f }
+{ /* empty by design */ }
+
+Capsule2D::Capsule2D(const Pt2 pt0_, const Pt2 pt1_, const float radius_) :
+	pt0{ pt0_ }, pt1{ pt1_ }, radius{ radius_ }
+{ /* empty by design */ }
+
+Capsule2D::Capsule2D(const Circle circle_, const Vec2 vel_) :
+	pt0{ circle_.center }, pt1{ circle_.center + vel_ }, radius{ circle_.radius }
+{ /* empty by design */ }
+
+ConvexPolygon2D::ConvexPolygon2D(const Pt2* vertices_, const size_t count_)
+{
+	if (count_ < 3 || MAX_VERTICES < count_)
+	{ throw "Vertex count out of range in ConvexPolygon2D()"; }
+
+	count = count_;
+	for (size_t i{ 0 }; i < count; ++i)
+	{ vertices[i] = vertices_[i]; }
+
+	// shoelace, negative area is clockwise
+	float area{ 0 };
+	for (size_t i{ 0 }; i < count; ++i)
+	{ area += Vector2DCrossProductMag(vertices[i], vertices[(i + 1) % count]); }
+	if (area < 0)
+	{ std::reverse(vertices, vertices + count); }
+
+	for (size_t i{ 0 }; i < count; ++i)
+	{
+		const Vec2 edge = vertices[(i + 1) % count] - vertices[i];
+		const Vec2 next = vertices[(i + 2) % count] - vertices[(i + 1) % count];
+		if (Vector2DCrossProductMag(edge, next) < 0)
+		{ throw "Polygon is not convex in ConvexPolygon2D()"; }
+		const float length = edge.Length();
+		if (length <= VEC2_EPSILON)
+		{ throw "Division by 0 in ConvexPolygon2D()"; }
+		normals[i] = Vec2{ edge.y, -edge.x } * (1.0f / length);
+	}
+}
+
+ConvexPolygon2D::ConvexPolygon2D(const AABB aabb_) :
+	ConvexPolygon2D(OBB2D(aabb_))
+{ /* empty by design */ }
+
+ConvexPolygon2D::ConvexPolygon2D(const OBB2D obb_) : count{ 4 }
+{
+	const Vec2 axis_x = obb_.rot * Vec2{ 1, 0 }, axis_y = obb_.rot * Vec2{ 0, 1 };
+	const Vec2 half_x = axis_x * obb_.half_ext.x, half_y = axis_y * obb_.half_ext.y;
+	vertices[0] = obb_.center - half_x - half_y;
+	vertices[1] = obb_.center + half_x - half_y;
+	vertices[2] = obb_.center + half_x + half_y;
+	vertices[3] = obb_.center - half_x + half_y;
+	normals[0] = -axis_y;
+	normals[1] = axis_x;
+	normals[2] = axis_y;
+	normals[3] = -axis_x;
+}
+
+Pt2 ConvexPolygon2D::Support(const Vec2 dir_) const
+{
+	size_t best{ 0 };
+	float best_dot = Vector2DDotProduct(vertices[0], dir_);
+	for (size_t i{ 1 }; i < count; ++i)
+	{
+		const float dot = Vector2DDotProduct(vertices[i], dir_);
+		if (dot > best_dot)
+		{ best = i; best_dot = dot; }
+	}
+	return vertices[best];
+}
@@ -2,6 +2,7 @@
 #ifndef TYPES_HPP_
 #define TYPES_HPP_
 
+#include "Transform2D.hpp"
 #include "Vector2D.hpp"
 
 struct AABB; // just a forward declaration
@@ -11,7 +12,9 @@ struct LineSegment
 	Pt2	pt0;
 	Pt2	pt1;
 	Vec2 normal;
-	LineSegment(Pt2 pos_, float scale_, float dir_);	
+	LineSegment(Pt2 pos_, float scale_, float dir_);
+	// centered on xform_.pos, along xform_.rot applied to {1, 0}
+	LineSegment(const Transform2D& xform_, float scale_);
 };
 
 struct Circle
@@ -25,6 +28,10 @@ struct Ray
 {
 	Pt2 pt;
 	Vec2 dir;
+	Ray() = default;
+	Ray(Pt2 pt_, Vec2 dir_);
+	// from xform_.pos along xform_.rot applied to {1, 0}
+	explicit Ray(const Transform2D& xform_);
 };
 
 struct Rect
@@ -32,6 +39,7 @@ struct Rect
 	Pt2 center;
 	float width;
 	float height;
+	Rect(Pt2 center_, float width_, float height_);
 	Rect(const AABB aabb_);
 };
 
@@ -39,7 +47,49 @@ struct AABB
 {
 	Pt2 min;
 	Pt2 max;
+	AABB(Pt2 min_, Pt2 max_);
 	AABB(const Rect rect_);
 };
 
+// oriented box, half_ext along the local axes rot * {1, 0} and rot * {0, 1}
+struct OBB2D
+{
+	Pt2 center;
+	Vec2 half_ext;
+	Rot2 rot;
+	OBB2D(Pt2 center_, Vec2 half_ext_, Rot2 rot_);
+	OBB2D(Pt2 center_, Vec2 half_ext_, float dir_);
+	explicit OBB2D(const AABB aabb_);
+};
+
+// every point within radius of the segment pt0 - pt1
+struct Capsule2D
+{
+	Pt2 pt0;
+	Pt2 pt1;
+	float radius;
+	Capsule2D(Pt2 pt0_, Pt2 pt1_, float radius_);
+	// the area circle_ covers while moving by vel_
+	Capsule2D(const Circle circle_, Vec2 vel_);
+};
+
+// convex polygon with inline storage so arrays of them stay contiguous. Vertices are
+// counter-clockwise, normals[i] is the outward unit normal of vertices[i] -> vertices[i + 1]
+struct ConvexPolygon2D
+{
+	static constexpr size_t MAX_VERTICES = 8;
+
+	Pt2 vertices[MAX_VERTICES];
+	Vec2 normals[MAX_VERTICES];
+	size_t count{ 0 };
+
+	ConvexPolygon2D() = default;
+	// either winding, throws if count_ is outside [3, MAX_VERTICES] or the polygon is not convex
+	ConvexPolygon2D(const Pt2* vertices_, size_t count_);
+	explicit ConvexPolygon2D(const AABB aabb_);
+	explicit ConvexPolygon2D(const OBB2D obb_);
+	// the vertex farthest along dir_
+	Pt2 Support(Vec2 dir_) const;
+};
+
 #endif // TYPES_HPP_
@@ -0,0 +1,53 @@
+//
+#include "Types3D.hpp"
+
+//
+Ray3::Ray3(const Pt3 pt_, const Vec3 dir_) : pt{ pt_ }, dir{ dir_ }
+{ /* empty by design */ }
+
+//
+Ray3::Ray3(const Segment3& segment_) : pt{ segment_.pt0 }, dir{ segment_.pt1 - segment_.pt0 }
+{ /* empty by design */ }
+
+//
+Plane::Plane(const Vec3 normal_, const float offset_) : normal{ normal_ }, offset{ offset_ }
+{ /* empty by design */ }
+
+//
+Plane::Plane(const Vec3 normal_, const Pt3 point_) :
+	normal{ Vector3DNormalize(normal_) }, offset{ Vector3DDotProduct(normal, point_) }
+{ /* empty by design */ }
+
+//
+OBB3::OBB3(const Pt3 center_, const Vec3 half_ext_, const Matrix4x4& orientation_) :
+	center{ center_ }, half_ext{ half_ext_ }, orientation{ orientation_ }
+{
+	if (Mtx44Classify(orientation_) != Mtx44Kind::Rigid)
+	{ throw "Orientation is not a rotation in OBB3()"; }
+}
+
+//
+OBB3::OBB3(const AABB3& aabb_) :
+	center{ (aabb_.min + aabb_.max) * 0.5f }, half_ext{ (aabb_.max - aabb_.min) * 0.5f }, orientation{ Mtx44Identity() }
+{ /* empty by design */ }
+
+//
+ConvexHull3::ConvexHull3(const Pt3* vertices_, const size_t count_) : count{ count_ }
+{
+	if (count_ < 1 || MAX_VERTICES < count_)
+	{ throw "Vertex count out of range in ConvexHull3()"; }
+	for (size_t i{ 0 }; i < count_; ++i)
+	{ vertices[i] = vertices_[i]; }
+}
+
+//
+ConvexHull3::ConvexHull3(const OBB3& obb_) : count{ 8 }
+{
+	for (size_t i{ 0 }; i < 8; ++i)
+	{
+		const float sx = i & 1 ? obb_.half_ext.x : -obb_.half_ext.x;
+		const float sy = i & 2 ? obb_.half_ext.y : -obb_.half_ext.y;
+		const float sz = i & 4 ? obb_.half_ext.z : -obb_.half_ext.z;
+		vertices[i] = obb_.center + obb_.Axis(0) * sx + obb_.Axis(1) * sy + obb_.Axis(2) * sz;
+	}
+}
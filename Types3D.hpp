@@ -0,0 +1,124 @@
+//
+#pragma once
+#ifndef TYPES3D_HPP_
+#define TYPES3D_HPP_
+
+#include "Matrix4x4.hpp"
+#include "Vector3D.hpp"
+
+// the Support() members below are the farthest point along dir_, inline so GJK3D() can fold them
+
+struct Sphere
+{
+	Pt3 center;
+	float radius;
+	// the center if dir_ is 0
+	Pt3 Support(const Vec3& dir_) const
+	{
+		const float length = dir_.Length();
+		return length > 0 ? center + dir_ * (radius / length) : center;
+	}
+};
+
+struct AABB3
+{
+	Pt3 min;
+	Pt3 max;
+};
+
+struct Segment3
+{
+	Pt3 pt0;
+	Pt3 pt1;
+};
+
+// pt + dir * t for t in [0, 1], dir is the whole displacement like the 2D Ray
+struct Ray3
+{
+	Pt3 pt;
+	Vec3 dir;
+	Ray3() = default;
+	Ray3(Pt3 pt_, Vec3 dir_);
+	// from pt0 to pt1
+	explicit Ray3(const Segment3& segment_);
+};
+
+// the points p with dot(normal, p) = offset, normal is unit length
+struct Plane
+{
+	Vec3 normal;
+	float offset;
+	Plane() = default;
+	// normal_ has to be unit length already
+	Plane(Vec3 normal_, float offset_);
+	// through point_, normal_ is normalized so throws if it is 0
+	Plane(Vec3 normal_, Pt3 point_);
+};
+
+// the box axes are the columns of the upper-left 3x3 of orientation, its translation is ignored
+struct OBB3
+{
+	Pt3 center;
+	Vec3 half_ext;
+	Matrix4x4 orientation;
+	OBB3() = default;
+	// throws if orientation_ is not a rotation, see Mtx44Classify()
+	OBB3(Pt3 center_, Vec3 half_ext_, const Matrix4x4& orientation_);
+	//
+	explicit OBB3(const AABB3& aabb_);
+	// i_ in [0, 3)
+	Vec3 Axis(size_t i_) const
+	{ return { orientation.m2[0][i_], orientation.m2[1][i_], orientation.m2[2][i_] }; }
+	//
+	Pt3 Support(const Vec3& dir_) const
+	{
+		Pt3 result = center;
+		for (size_t i{ 0 }; i < 3; ++i)
+		{
+			const Vec3 axis = Axis(i);
+			result += Vector3DDotProduct(axis, dir_) < 0 ? axis * -half_ext.m[i] : axis * half_ext.m[i];
+		}
+		return result;
+	}
+};
+
+// a segment grown by radius
+struct Capsule3
+{
+	Pt3 pt0;
+	Pt3 pt1;
+	float radius;
+	//
+	Pt3 Support(const Vec3& dir_) const
+	{ return Sphere{ Vector3DDotProduct(pt1 - pt0, dir_) > 0 ? pt1 : pt0, radius }.Support(dir_); }
+};
+
+// the convex hull of up to MAX_VERTICES points, which need not all be on it
+struct ConvexHull3
+{
+	static constexpr size_t MAX_VERTICES = 32;
+
+	Pt3 vertices[MAX_VERTICES];
+	size_t count{ 0 };
+
+	ConvexHull3() = default;
+	// throws if count_ is outside [1, MAX_VERTICES]
+	ConvexHull3(const Pt3* vertices_, size_t count_);
+	//
+	explicit ConvexHull3(const OBB3& obb_);
+	//
+	Pt3 Support(const Vec3& dir_) const
+	{
+		size_t best{ 0 };
+		float best_dot = Vector3DDotProduct(vertices[0], dir_);
+		for (size_t i{ 1 }; i < count; ++i)
+		{
+			const float dot = Vector3DDotProduct(vertices[i], dir_);
+			if (dot > best_dot)
+			{ best = i; best_dot = dot; }
+		}
+		return vertices[best];
+	}
+};
+
+#endif // TYPES3D_HPP_
@@ -0,0 +1,553 @@
+//
+#include "Vec2Stream.hpp"
+#include <cstring> // memcpy(), memset()
+#include <utility> // std::swap()
+
+namespace
+{
+	/* SCALAR KERNELS */
+	// also used for the tails of the SIMD kernels, hence begin_
+
+	//
+	void AddScalar(float* rx_, float* ry_, const float* ax_, const float* ay_,
+		const float* bx_, const float* by_, size_t begin_, const size_t n_)
+	{
+		for (; begin_ < n_; ++begin_)
+		{
+			rx_[begin_] = ax_[begin_] + bx_[begin_];
+			ry_[begin_] = ay_[begin_] + by_[begin_];
+		}
+	}
+
+	//
+	void ScaleScalar(float* rx_, float* ry_, const float* ax_, const float* ay_,
+		const float s_, size_t begin_, const size_t n_)
+	{
+		for (; begin_ < n_; ++begin_)
+		{
+			rx_[begin_] = ax_[begin_] * s_;
+			ry_[begin_] = ay_[begin_] * s_;
+		}
+	}
+
+	//
+	void DotScalar(float* r_, const float* ax_, const float* ay_,
+		const float* bx_, const float* by_, size_t begin_, const size_t n_)
+	{
+		for (; begin_ < n_; ++begin_)
+		{ r_[begin_] = ax_[begin_] * bx_[begin_] + ay_[begin_] * by_[begin_]; }
+	}
+
+	//
+	void LengthSqScalar(float* r_, const float* ax_, const float* ay_, size_t begin_, const size_t n_)
+	{
+		for (; begin_ < n_; ++begin_)
+		{ r_[begin_] = ax_[begin_] * ax_[begin_] + ay_[begin_] * ay_[begin_]; }
+	}
+
+	//
+	void LengthScalar(float* r_, const float* ax_, const float* ay_, size_t begin_, const size_t n_)
+	{
+		for (; begin_ < n_; ++begin_)
+		{ r_[begin_] = sqrtf(ax_[begin_] * ax_[begin_] + ay_[begin_] * ay_[begin_]); }
+	}
+
+	//
+	void NormalizeScalar(float* rx_, float* ry_, const float* ax_, const float* ay_, size_t begin_, const size_t n_)
+	{
+		for (; begin_ < n_; ++begin_)
+		{
+			const float magnitude = sqrtf(ax_[begin_] * ax_[begin_] + ay_[begin_] * ay_[begin_]);
+			const float inv = magnitude > VEC2_EPSILON ? 1.0f / magnitude : 0.0f;
+			rx_[begin_] = ax_[begin_] * inv;
+			ry_[begin_] = ay_[begin_] * inv;
+		}
+	}
+
+	//
+	void NormalizeFastScalar(float* rx_, float* ry_, const float* ax_, const float* ay_, size_t begin_, const size_t n_)
+	{
+		for (; begin_ < n_; ++begin_)
+		{
+			const float magnitude_sq = ax_[begin_] * ax_[begin_] + ay_[begin_] * ay_[begin_];
+			const float inv = magnitude_sq > VEC2_EPSILON * VEC2_EPSILON ? SIMDInvSqrtFast(magnitude_sq) : 0.0f;
+			rx_[begin_] = ax_[begin_] * inv;
+			ry_[begin_] = ay_[begin_] * inv;
+		}
+	}
+
+	//
+	void DistSqScalar(float* r_, const float* ax_, const float* ay_,
+		const float* bx_, const float* by_, size_t begin_, const size_t n_)
+	{
+		for (; begin_ < n_; ++begin_)
+		{
+			const float dx = ax_[begin_] - bx_[begin_], dy = ay_[begin_] - by_[begin_];
+			r_[begin_] = dx * dx + dy * dy;
+		}
+	}
+
+	#if SIMD_X86
+	/* SSE KERNELS */
+
+	//
+	SIMD_TARGET_SSE void AddSSE(float* rx_, float* ry_, const float* ax_, const float* ay_,
+		const float* bx_, const float* by_, const size_t n_)
+	{
+		size_t i{ 0 };
+		for (; i + 4 <= n_; i += 4)
+		{
+			_mm_storeu_ps(rx_ + i, _mm_add_ps(_mm_loadu_ps(ax_ + i), _mm_loadu_ps(bx_ + i)));
+			_mm_storeu_ps(ry_ + i, _mm_add_ps(_mm_loadu_ps(ay_ + i), _mm_loadu_ps(by_ + i)));
+		}
+		AddScalar(rx_, ry_, ax_, ay_, bx_, by_, i, n_);
+	}
+
+	//
+	SIMD_TARGET_SSE void ScaleSSE(float* rx_, float* ry_, const float* ax_, const float* ay_,
+		const float s_, const size_t n_)
+	{
+		const __m128 s = _mm_set1_ps(s_);
+		size_t i{ 0 };
+		for (; i + 4 <= n_; i += 4)
+		{
+			_mm_storeu_ps(rx_ + i, _mm_mul_ps(_mm_loadu_ps(ax_ + i), s));
+			_mm_storeu_ps(ry_ + i, _mm_mul_ps(_mm_loadu_ps(ay_ + i), s));
+		}
+		ScaleScalar(rx_, ry_, ax_, ay_, s_, i, n_);
+	}
+
+	//
+	SIMD_TARGET_SSE void DotSSE(float* r_, const float* ax_, const float* ay_,
+		const float* bx_, const float* by_, const size_t n_)
+	{
+		size_t i{ 0 };
+		for (; i + 4 <= n_; i += 4)
+		{
+			const __m128 xx = _mm_mul_ps(_mm_loadu_ps(ax_ + i), _mm_loadu_ps(bx_ + i));
+			const __m128 yy = _mm_mul_ps(_mm_loadu_ps(ay_ + i), _mm_loadu_ps(by_ + i));
+			_mm_storeu_ps(r_ + i, _mm_add_ps(xx, yy));
+		}
+		DotScalar(r_, ax_, ay_, bx_, by_, i, n_);
+	}
+
+	//
+	SIMD_TARGET_SSE void LengthSqSSE(float* r_, const float* ax_, const float* ay_, const size_t n_)
+	{
+		size_t i{ 0 };
+		for (; i + 4 <= n_; i += 4)
+		{
+			const __m128 x = _mm_loadu_ps(ax_ + i), y = _mm_loadu_ps(ay_ + i);
+			_mm_storeu_ps(r_ + i, _mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)));
+		}
+		LengthSqScalar(r_, ax_, ay_, i, n_);
+	}
+
+	//
+	SIMD_TARGET_SSE void LengthSSE(float* r_, const float* ax_, const float* ay_, const size_t n_)
+	{
+		size_t i{ 0 };
+		for (; i + 4 <= n_; i += 4)
+		{
+			const __m128 x = _mm_loadu_ps(ax_ + i), y = _mm_loadu_ps(ay_ + i);
+			_mm_storeu_ps(r_ + i, _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y))));
+		}
+		LengthScalar(r_, ax_, ay_, i, n_);
+	}
+
+	//
+	SIMD_TARGET_SSE void NormalizeSSE(float* rx_, float* ry_, const float* ax_, const float* ay_, const size_t n_)
+	{
+		const __m128 eps = _mm_set1_ps(VEC2_EPSILON), one = _mm_set1_ps(1.0f);
+		size_t i{ 0 };
+		for (; i + 4 <= n_; i += 4)
+		{
+			const __m128 x = _mm_loadu_ps(ax_ + i), y = _mm_loadu_ps(ay_ + i);
+			const __m128 magnitude = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)));
+			// lanes at or below epsilon are masked to zero instead of dividing by 0
+			const __m128 inv = _mm_and_ps(_mm_cmpgt_ps(magnitude, eps), _mm_div_ps(one, magnitude));
+			_mm_storeu_ps(rx_ + i, _mm_mul_ps(x, inv));
+			_mm_storeu_ps(ry_ + i, _mm_mul_ps(y, inv));
+		}
+		NormalizeScalar(rx_, ry_, ax_, ay_, i, n_);
+	}
+
+	// y0 = rsqrt(x), y1 = y0 * (1.5 - 0.5 * x * y0 * y0)
+	SIMD_TARGET_SSE void NormalizeFastSSE(float* rx_, float* ry_, const float* ax_, const float* ay_, const size_t n_)
+	{
+		const __m128 eps_sq = _mm_set1_ps(VEC2_EPSILON * VEC2_EPSILON);
+		const __m128 half = _mm_set1_ps(0.5f), three_halves = _mm_set1_ps(1.5f);
+		size_t i{ 0 };
+		for (; i + 4 <= n_; i += 4)
+		{
+			const __m128 x = _mm_loadu_ps(ax_ + i), y = _mm_loadu_ps(ay_ + i);
+			const __m128 magnitude_sq = _mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y));
+			const __m128 y0 = _mm_rsqrt_ps(magnitude_sq);
+			const __m128 y1 = _mm_mul_ps(y0, _mm_sub_ps(three_halves, _mm_mul_ps(_mm_mul_ps(half, magnitude_sq), _mm_mul_ps(y0, y0))));
+			const __m128 inv = _mm_and_ps(_mm_cmpgt_ps(magnitude_sq, eps_sq), y1);
+			_mm_storeu_ps(rx_ + i, _mm_mul_ps(x, inv));
+			_mm_storeu_ps(ry_ + i, _mm_mul_ps(y, inv));
+		}
+		NormalizeFastScalar(rx_, ry_, ax_, ay_, i, n_);
+	}
+
+	//
+	SIMD_TARGET_SSE void DistSqSSE(float* r_, const float* ax_, const float* ay_,
+		const float* bx_, const float* by_, const size_t n_)
+	{
+		size_t i{ 0 };
+		for (; i + 4 <= n_; i += 4)
+		{
+			const __m128 dx = _mm_sub_ps(_mm_loadu_ps(ax_ + i), _mm_loadu_ps(bx_ + i));
+			const __m128 dy = _mm_sub_ps(_mm_loadu_ps(ay_ + i), _mm_loadu_ps(by_ + i));
+			_mm_storeu_ps(r_ + i, _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)));
+		}
+		DistSqScalar(r_, ax_, ay_, bx_, by_, i, n_);
+	}
+
+	/* AVX2 KERNELS */
+
+	//
+	SIMD_TARGET_AVX2 void AddAVX2(float* rx_, float* ry_, const float* ax_, const float* ay_,
+		const float* bx_, const float* by_, const size_t n_)
+	{
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			_mm256_storeu_ps(rx_ + i, _mm256_add_ps(_mm256_loadu_ps(ax_ + i), _mm256_loadu_ps(bx_ + i)));
+			_mm256_storeu_ps(ry_ + i, _mm256_add_ps(_mm256_loadu_ps(ay_ + i), _mm256_loadu_ps(by_ + i)));
+		}
+		AddScalar(rx_, ry_, ax_, ay_, bx_, by_, i, n_);
+	}
+
+	//
+	SIMD_TARGET_AVX2 void ScaleAVX2(float* rx_, float* ry_, const float* ax_, const float* ay_,
+		const float s_, const size_t n_)
+	{
+		const __m256 s = _mm256_set1_ps(s_);
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			_mm256_storeu_ps(rx_ + i, _mm256_mul_ps(_mm256_loadu_ps(ax_ + i), s));
+			_mm256_storeu_ps(ry_ + i, _mm256_mul_ps(_mm256_loadu_ps(ay_ + i), s));
+		}
+		ScaleScalar(rx_, ry_, ax_, ay_, s_, i, n_);
+	}
+
+	//
+	SIMD_TARGET_AVX2 void DotAVX2(float* r_, const float* ax_, const float* ay_,
+		const float* bx_, const float* by_, const size_t n_)
+	{
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const __m256 xx = _mm256_mul_ps(_mm256_loadu_ps(ax_ + i), _mm256_loadu_ps(bx_ + i));
+			_mm256_storeu_ps(r_ + i, _mm256_fmadd_ps(_mm256_loadu_ps(ay_ + i), _mm256_loadu_ps(by_ + i), xx));
+		}
+		DotScalar(r_, ax_, ay_, bx_, by_, i, n_);
+	}
+
+	//
+	SIMD_TARGET_AVX2 void LengthSqAVX2(float* r_, const float* ax_, const float* ay_, const size_t n_)
+	{
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const __m256 x = _mm256_loadu_ps(ax_ + i), y = _mm256_loadu_ps(ay_ + i);
+			_mm256_storeu_ps(r_ + i, _mm256_fmadd_ps(y, y, _mm256_mul_ps(x, x)));
+		}
+		LengthSqScalar(r_, ax_, ay_, i, n_);
+	}
+
+	//
+	SIMD_TARGET_AVX2 void LengthAVX2(float* r_, const float* ax_, const float* ay_, const size_t n_)
+	{
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const __m256 x = _mm256_loadu_ps(ax_ + i), y = _mm256_loadu_ps(ay_ + i);
+			_mm256_storeu_ps(r_ + i, _mm256_sqrt_ps(_mm256_fmadd_ps(y, y, _mm256_mul_ps(x, x))));
+		}
+		LengthScalar(r_, ax_, ay_, i, n_);
+	}
+
+	//
+	SIMD_TARGET_AVX2 void NormalizeAVX2(float* rx_, float* ry_, const float* ax_, const float* ay_, const size_t n_)
+	{
+		const __m256 eps = _mm256_set1_ps(VEC2_EPSILON), one = _mm256_set1_ps(1.0f);
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const __m256 x = _mm256_loadu_ps(ax_ + i), y = _mm256_loadu_ps(ay_ + i);
+			const __m256 magnitude = _mm256_sqrt_ps(_mm256_fmadd_ps(y, y, _mm256_mul_ps(x, x)));
+			// lanes at or below epsilon are masked to zero instead of dividing by 0
+			const __m256 inv = _mm256_and_ps(_mm256_cmp_ps(magnitude, eps, _CMP_GT_OQ), _mm256_div_ps(one, magnitude));
+			_mm256_storeu_ps(rx_ + i, _mm256_mul_ps(x, inv));
+			_mm256_storeu_ps(ry_ + i, _mm256_mul_ps(y, inv));
+		}
+		NormalizeScalar(rx_, ry_, ax_, ay_, i, n_);
+	}
+
+	// y0 = rsqrt(x), y1 = y0 * (1.5 - 0.5 * x * y0 * y0)
+	SIMD_TARGET_AVX2 void NormalizeFastAVX2(float* rx_, float* ry_, const float* ax_, const float* ay_, const size_t n_)
+	{
+		const __m256 eps_sq = _mm256_set1_ps(VEC2_EPSILON * VEC2_EPSILON);
+		const __m256 half = _mm256_set1_ps(0.5f), three_halves = _mm256_set1_ps(1.5f);
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const __m256 x = _mm256_loadu_ps(ax_ + i), y = _mm256_loadu_ps(ay_ + i);
+			const __m256 magnitude_sq = _mm256_fmadd_ps(y, y, _mm256_mul_ps(x, x));
+			const __m256 y0 = _mm256_rsqrt_ps(magnitude_sq);
+			const __m256 y1 = _mm256_mul_ps(y0, _mm256_fnmadd_ps(_mm256_mul_ps(half, magnitude_sq), _mm256_mul_ps(y0, y0), three_halves));
+			const __m256 inv = _mm256_and_ps(_mm256_cmp_ps(magnitude_sq, eps_sq, _CMP_GT_OQ), y1);
+			_mm256_storeu_ps(rx_ + i, _mm256_mul_ps(x, inv));
+			_mm256_storeu_ps(ry_ + i, _mm256_mul_ps(y, inv));
+		}
+		NormalizeFastScalar(rx_, ry_, ax_, ay_, i, n_);
+	}
+
+	//
+	SIMD_TARGET_AVX2 void DistSqAVX2(float* r_, const float* ax_, const float* ay_,
+		const float* bx_, const float* by_, const size_t n_)
+	{
+		size_t i{ 0 };
+		for (; i + 8 <= n_; i += 8)
+		{
+			const __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(ax_ + i), _mm256_loadu_ps(bx_ + i));
+			const __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(ay_ + i), _mm256_loadu_ps(by_ + i));
+			_mm256_storeu_ps(r_ + i, _mm256_fmadd_ps(dy, dy, _mm256_mul_ps(dx, dx)));
+		}
+		DistSqScalar(r_, ax_, ay_, bx_, by_, i, n_);
+	}
+	#endif
+
+	//
+	void CheckSizes(const Vec2Stream& lhs_, const Vec2Stream& rhs_, const char* msg_)
+	{
+		if (lhs_.Size() != rhs_.Size())
+		{ throw msg_; }
+	}
+}
+
+//
+Vec2Stream::Vec2Stream(const size_t size_)
+{ Resize(size_); }
+
+//
+Vec2Stream::Vec2Stream(const Vector2D* pArr_, const size_t size_)
+{
+	Resize(size_);
+	for (size_t i{ 0 }; i < size_; ++i)
+	{ Set(i, pArr_[i]); }
+}
+
+//
+Vec2Stream::Vec2Stream(const Vec2Stream& rhs_)
+{
+	Resize(rhs_.size);
+	if (size)
+	{
+		memcpy(x, rhs_.x, size * sizeof(float));
+		memcpy(y, rhs_.y, size * sizeof(float));
+	}
+}
+
+//
+Vec2Stream::Vec2Stream(Vec2Stream&& rhs_) noexcept
+{ Swap(rhs_); }
+
+//
+Vec2Stream::~Vec2Stream()
+{ SIMDAlignedFree(x); }
+
+//
+Vec2Stream& Vec2Stream::operator=(Vec2Stream rhs_)
+{
+	// copy swap idiom
+	Swap(rhs_);
+	return *this;
+}
+
+//
+void Vec2Stream::Reserve(const size_t capacity_)
+{
+	if (capacity_ <= capacity)
+	{ return; }
+
+	// x and y share one block, y starts right after x's padding
+	const size_t padded = SIMDPaddedSize(capacity_);
+	float* block = static_cast<float*>(SIMDAlignedAlloc(2 * padded * sizeof(float)));
+	memset(block, 0, 2 * padded * sizeof(float));
+	if (size)
+	{
+		memcpy(block, x, size * sizeof(float));
+		memcpy(block + padded, y, size * sizeof(float));
+	}
+	SIMDAlignedFree(x);
+	x = block;
+	y = block + padded;
+	capacity = padded;
+}
+
+//
+void Vec2Stream::Resize(const size_t size_)
+{
+	Reserve(size_);
+	if (size_ > size)
+	{
+		memset(x + size, 0, (size_ - size) * sizeof(float));
+		memset(y + size, 0, (size_ - size) * sizeof(float));
+	}
+	else if (size_ < size)
+	{
+		// keep the padding zero, past the old size's padding it already is
+		const size_t padded = SIMDPaddedSize(size);
+		memset(x + size_, 0, (padded - size_) * sizeof(float));
+		memset(y + size_, 0, (padded - size_) * sizeof(float));
+	}
+	size = size_;
+}
+
+//
+void Vec2Stream::PushBack(const Vector2D& vec_)
+{
+	if (size == capacity)
+	{ Reserve(capacity ? capacity * 2 : SIMD_WIDTH); }
+	Set(size++, vec_);
+}
+
+//
+void Vec2Stream::Clear()
+{
+	// through Resize() so the padding stays zero
+	Resize(0);
+}
+
+//
+void Vec2Stream::Swap(Vec2Stream& rhs_) noexcept
+{
+	std::swap(x, rhs_.x);
+	std::swap(y, rhs_.y);
+	std::swap(size, rhs_.size);
+	std::swap(capacity, rhs_.capacity);
+}
+
+//
+void Vec2StreamAdd(Vec2Stream& result_, const Vec2Stream& lhs_, const Vec2Stream& rhs_)
+{
+	CheckSizes(lhs_, rhs_, "Size mismatch in Vec2StreamAdd()");
+	const size_t n = lhs_.Size();
+	result_.Resize(n);
+	switch (SIMDGetLevel())
+	{
+	#if SIMD_X86
+	case SIMDLevel::AVX2: AddAVX2(result_.x, result_.y, lhs_.x, lhs_.y, rhs_.x, rhs_.y, n); break;
+	case SIMDLevel::SSE: AddSSE(result_.x, result_.y, lhs_.x, lhs_.y, rhs_.x, rhs_.y, n); break;
+	#endif
+	default: AddScalar(result_.x, result_.y, lhs_.x, lhs_.y, rhs_.x, rhs_.y, 0, n); break;
+	}
+}
+
+//
+void Vec2StreamScale(Vec2Stream& result_, const Vec2Stream& vec_, const float scale_)
+{
+	const size_t n = vec_.Size();
+	result_.Resize(n);
+	switch (SIMDGetLevel())
+	{
+	#if SIMD_X86
+	case SIMDLevel::AVX2: ScaleAVX2(result_.x, result_.y, vec_.x, vec_.y, scale_, n); break;
+	case SIMDLevel::SSE: ScaleSSE(result_.x, result_.y, vec_.x, vec_.y, scale_, n); break;
+	#endif
+	default: ScaleScalar(result_.x, result_.y, vec_.x, vec_.y, scale_, 0, n); break;
+	}
+}
+
+//
+void Vec2StreamDotProduct(float* result_, const Vec2Stream& lhs_, const Vec2Stream& rhs_)
+{
+	CheckSizes(lhs_, rhs_, "Size mismatch in Vec2StreamDotProduct()");
+	const size_t n = lhs_.Size();
+	switch (SIMDGetLevel())
+	{
+	#if SIMD_X86
+	case SIMDLevel::AVX2: DotAVX2(result_, lhs_.x, lhs_.y, rhs_.x, rhs_.y, n); break;
+	case SIMDLevel::SSE: DotSSE(result_, lhs_.x, lhs_.y, rhs_.x, rhs_.y, n); break;
+	#endif
+	default: DotScalar(result_, lhs_.x, lhs_.y, rhs_.x, rhs_.y, 0, n); break;
+	}
+}
+
+//
+void Vec2StreamLength(float* result_, const Vec2Stream& vec_)
+{
+	const size_t n = vec_.Size();
+	switch (SIMDGetLevel())
+	{
+	#if SIMD_X86
+	case SIMDLevel::AVX2: LengthAVX2(result_, vec_.x, vec_.y, n); break;
+	case SIMDLevel::SSE: LengthSSE(result_, vec_.x, vec_.y, n); break;
+	#endif
+	default: LengthScalar(result_, vec_.x, vec_.y, 0, n); break;
+	}
+}
+
+//
+void Vec2StreamLengthSq(float* result_, const Vec2Stream& vec_)
+{
+	const size_t n = vec_.Size();
+	switch (SIMDGetLevel())
+	{
+	#if SIMD_X86
+	case SIMDLevel::AVX2: LengthSqAVX2(result_, vec_.x, vec_.y, n); break;
+	case SIMDLevel::SSE: LengthSqSSE(result_, vec_.x, vec_.y, n); break;
+	#endif
+	default: LengthSqScalar(result_, vec_.x, vec_.y, 0, n); break;
+	}
+}
+
+//
+void Vec2StreamNormalize(Vec2Stream& result_, const Vec2Stream& vec_)
+{
+	const size_t n = vec_.Size();
+	result_.Resize(n);
+	switch (SIMDGetLevel())
+	{
+	#if SIMD_X86
+	case SIMDLevel::AVX2: NormalizeAVX2(result_.x, result_.y, vec_.x, vec_.y, n); break;
+	case SIMDLevel::SSE: NormalizeSSE(result_.x, result_.y, vec_.x, vec_.y, n); break;
+	#endif
+	default: NormalizeScalar(result_.x, result_.y, vec_.x, vec_.y, 0, n); break;
+	}
+}
+
+//
+void Vec2StreamNormalizeFast(Vec2Stream& result_, const Vec2Stream& vec_)
+{
+	const size_t n = vec_.Size();
+	result_.Resize(n);
+	switch (SIMDGetLevel())
+	{
+	#if SIMD_X86
+	case SIMDLevel::AVX2: NormalizeFastAVX2(result_.x, result_.y, vec_.x, vec_.y, n); break;
+	case SIMDLevel::SSE: NormalizeFastSSE(result_.x, result_.y, vec_.x, vec_.y, n); break;
+	#endif
+	default: NormalizeFastScalar(result_.x, result_.y, vec_.x, vec_.y, 0, n); break;
+	}
+}
+
+//
+void Vec2StreamSquaredDistance(float* result_, const Vec2Stream& lhs_, const Vec2Stream& rhs_)
+{
+	CheckSizes(lhs_, rhs_, "Size mismatch in Vec2StreamSquaredDistance()");
+	const size_t n = lhs_.Size();
+	switch (SIMDGetLevel())
+	{
+	#if SIMD_X86
+	case SIMDLevel::AVX2: DistSqAVX2(result_, lhs_.x, lhs_.y, rhs_.x, rhs_.y, n); break;
+	case SIMDLevel::SSE: DistSqSSE(result_, lhs_.x, lhs_.y, rhs_.x, rhs_.y, n); break;
+	#endif
+	default: DistSqScalar(result_, lhs_.x, lhs_.y, rhs_.x, rhs_.y, 0, n); break;
+	}
+}
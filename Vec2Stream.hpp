@@ -0,0 +1,107 @@
+//
+#pragma once
+#ifndef VEC2_STREAM_HPP_
+#define VEC2_STREAM_HPP_
+
+#include "SIMD.hpp"
+#include "Vector2D.hpp"
+
+// structure-of-arrays Vector2D storage: x[] and y[] are separate,
+// SIMD_ALIGNMENT aligned and zero padded to a multiple of SIMD_WIDTH
+struct Vec2Stream
+{
+	float* x{ nullptr };
+	float* y{ nullptr };
+
+	/* Constructors */
+
+	//
+	Vec2Stream() = default;
+
+	//
+	explicit Vec2Stream(size_t size_);
+
+	//
+	Vec2Stream(const Vector2D* pArr_, size_t size_);
+
+	//
+	Vec2Stream(const Vec2Stream& rhs_);
+
+	//
+	Vec2Stream(Vec2Stream&& rhs_) noexcept;
+
+	//
+	~Vec2Stream();
+
+	/* Assignment Operators */
+
+	//
+	Vec2Stream& operator=(Vec2Stream rhs_);
+
+	/* Others */
+
+	//
+	size_t Size() const
+	{ return size; }
+
+	//
+	size_t Capacity() const
+	{ return capacity; }
+
+	//
+	Vector2D Get(size_t i_) const
+	{ return { x[i_], y[i_] }; }
+
+	//
+	void Set(size_t i_, const Vector2D& vec_)
+	{ x[i_] = vec_.x; y[i_] = vec_.y; }
+
+	//
+	void Reserve(size_t capacity_);
+
+	// new elements are zeroed
+	void Resize(size_t size_);
+
+	//
+	void PushBack(const Vector2D& vec_);
+
+	//
+	void Clear();
+
+	//
+	void Swap(Vec2Stream& rhs_) noexcept;
+
+private:
+	size_t size{ 0 };
+	size_t capacity{ 0 };
+};
+
+/* BATCH KERNELS */
+// all of these dispatch on SIMDGetLevel() and handle any size, not just
+// multiples of SIMD_WIDTH. result_ may alias an input.
+
+// result_[i] = lhs_[i] + rhs_[i]
+void Vec2StreamAdd(Vec2Stream& result_, const Vec2Stream& lhs_, const Vec2Stream& rhs_);
+
+// result_[i] = vec_[i] * scale_
+void Vec2StreamScale(Vec2Stream& result_, const Vec2Stream& vec_, float scale_);
+
+// result_[i] = dot(lhs_[i], rhs_[i]), result_ holds at least lhs_.Size() floats
+void Vec2StreamDotProduct(float* result_, const Vec2Stream& lhs_, const Vec2Stream& rhs_);
+
+//
+void Vec2StreamLength(float* result_, const Vec2Stream& vec_);
+
+//
+void Vec2StreamLengthSq(float* result_, const Vec2Stream& vec_);
+
+// unlike Vector2DNormalize() this does not throw, zero-length vectors stay zero
+void Vec2StreamNormalize(Vec2Stream& result_, const Vec2Stream& vec_);
+
+// batch Vector2DNormalizeFast(), same error bound, zero-length vectors stay zero
+void Vec2StreamNormalizeFast(Vec2Stream& result_, const Vec2Stream& vec_);
+
+//
+void Vec2StreamSquaredDistance(float* result_, const Vec2Stream& lhs_, const Vec2Stream& rhs_);
+
+#endif // VEC2_STREAM_HPP_
@@ -0,0 +1,281 @@
+//
+#pragma once
+#ifndef VECTOR_H_
+#define VECTOR_H_
+
+#include <cmath> // std::sqrt()
+#include <cstddef> // size_t
+#include <type_traits> // std::integral_constant
+#include <utility> // std::swap(), std::index_sequence
+
+// same tolerance the float typedefs always used, for any precision
+template <typename T>
+constexpr T VECTOR_EPSILON = static_cast<T>(0.0001);
+
+// compile-time component index for VectorData::Get()
+template <size_t I>
+using VectorIndex = std::integral_constant<size_t, I>;
+
+// storage only, so Vector<T, N> can name its members x, y, z, w where it makes sense.
+// Get() reads the member the constructors wrote (x, y... rather than m[]), which
+// keeps the generic operators usable in constant expressions.
+template <typename T, size_t N>
+struct VectorData
+{
+	T m[N]{};
+
+	template <size_t I>
+	constexpr T Get(VectorIndex<I>) const
+	{ return m[I]; }
+
+	constexpr VectorData()
+	{ /* empty by design */ }
+
+	template <typename... Ts>
+	constexpr VectorData(Ts... ts_) : m{ static_cast<T>(ts_)... }
+	{ static_assert(sizeof...(Ts) == N, "wrong number of components"); }
+};
+
+//
+template <typename T>
+struct VectorData<T, 2>
+{
+	// some warning about a nameless struct
+	// but it's way more convenient this way :(
+	union
+	{
+		struct
+		{ T x, y; };
+
+		T m[2];
+	};
+
+	constexpr T Get(VectorIndex<0>) const
+	{ return x; }
+
+	constexpr T Get(VectorIndex<1>) const
+	{ return y; }
+
+	constexpr VectorData() : x{ 0 }, y{ 0 }
+	{ /* empty by design */ }
+
+	constexpr VectorData(T x_, T y_) : x{ x_ }, y{ y_ }
+	{ /* empty by design */ }
+};
+
+//
+template <typename T>
+struct VectorData<T, 3>
+{
+	union
+	{
+		struct
+		{ T x, y, z; };
+
+		T m[3];
+	};
+
+	constexpr T Get(VectorIndex<0>) const
+	{ return x; }
+
+	constexpr T Get(VectorIndex<1>) const
+	{ return y; }
+
+	constexpr T Get(VectorIndex<2>) const
+	{ return z; }
+
+	constexpr VectorData() : x{ 0 }, y{ 0 }, z{ 0 }
+	{ /* empty by design */ }
+
+	constexpr VectorData(T x_, T y_, T z_) : x{ x_ }, y{ y_ }, z{ z_ }
+	{ /* empty by design */ }
+};
+
+//
+template <typename T>
+struct VectorData<T, 4>
+{
+	union
+	{
+		struct
+		{ T x, y, z, w; };
+
+		T m[4];
+	};
+
+	constexpr T Get(VectorIndex<0>) const
+	{ return x; }
+
+	constexpr T Get(VectorIndex<1>) const
+	{ return y; }
+
+	constexpr T Get(VectorIndex<2>) const
+	{ return z; }
+
+	constexpr T Get(VectorIndex<3>) const
+	{ return w; }
+
+	constexpr VectorData() : x{ 0 }, y{ 0 }, z{ 0 }, w{ 0 }
+	{ /* empty by design */ }
+
+	constexpr VectorData(T x_, T y_, T z_, T w_) : x{ x_ }, y{ y_ }, z{ z_ }, w{ w_ }
+	{ /* empty by design */ }
+};
+
+template <typename T, size_t N>
+struct Vector;
+
+// component i = fn_(VectorIndex<i>{}) for every component, expanded at compile time
+template <typename T, size_t N, typename Fn, size_t... Is>
+constexpr Vector<T, N> VectorGenerate(Fn fn_, std::index_sequence<Is...>)
+{ return Vector<T, N>(fn_(VectorIndex<Is>{})...); }
+
+//
+template <typename T, size_t N, typename Fn>
+constexpr Vector<T, N> VectorGenerate(Fn fn_)
+{ return VectorGenerate<T, N>(fn_, std::make_index_sequence<N>{}); }
+
+// N components of T. Every loop over N is expanded at compile time through
+// std::index_sequence, so Vector<float, 3> compiles to the same straight-line
+// code the hand-written Vector3D had.
+template <typename T, size_t N>
+struct Vector : VectorData<T, N>
+{
+	/* Constructors */
+
+	// all zeros
+	constexpr Vector() = default;
+
+	// one argument per component
+	using VectorData<T, N>::VectorData;
+
+	// between precisions, e.g. a double world position down to float for rendering
+	template <typename U>
+	constexpr explicit Vector(const Vector<U, N>& rhs_) :
+	Vector(rhs_, std::make_index_sequence<N>{})
+	{ /* empty by design */ }
+
+	/* Assignment Operators */
+
+	// defaulted so the type stays trivially copyable (passed in registers)
+	Vector& operator=(const Vector& rhs_) = default;
+
+	//
+	constexpr Vector& operator+=(const Vector& rhs_)
+	{ return *this = *this + rhs_; }
+
+	//
+	constexpr Vector& operator-=(const Vector& rhs_)
+	{ return *this = *this - rhs_; }
+
+	//
+	constexpr Vector& operator*=(T rhs_)
+	{ return *this = *this * rhs_; }
+
+	//
+	constexpr Vector& operator/=(T rhs_)
+	{ return *this = *this / rhs_; }
+
+	/* Unary Operators */
+
+	//
+	constexpr Vector operator-() const
+	{ return *this * static_cast<T>(-1); }
+
+	/* Comparison Operators */
+
+	// component-wise within VECTOR_EPSILON
+	constexpr bool operator==(const Vector& rhs_) const
+	{ return Equal(rhs_, std::make_index_sequence<N>{}); }
+
+	/* Binary Operators */
+	// friends rather than templates so 2 * vec_ and vec_ / 2 still convert the scalar
+
+	//
+	friend constexpr Vector operator+(const Vector& lhs_, const Vector& rhs_)
+	{ return VectorGenerate<T, N>([&](auto i_) { return lhs_.Get(i_) + rhs_.Get(i_); }); }
+
+	//
+	friend constexpr Vector operator-(const Vector& lhs_, const Vector& rhs_)
+	{ return VectorGenerate<T, N>([&](auto i_) { return lhs_.Get(i_) - rhs_.Get(i_); }); }
+
+	//
+	friend constexpr Vector operator*(const Vector& lhs_, const T rhs_)
+	{ return VectorGenerate<T, N>([&](auto i_) { return lhs_.Get(i_) * rhs_; }); }
+
+	//
+	friend constexpr Vector operator*(const T lhs_, const Vector& rhs_)
+	{ return rhs_ * lhs_; }
+
+	//
+	friend constexpr Vector operator/(const Vector& lhs_, const T rhs_)
+	{
+		if (-VECTOR_EPSILON<T> <= rhs_ && rhs_ <= VECTOR_EPSILON<T>)
+		{ throw "Division by 0 in Vector operator/"; }
+		return VectorGenerate<T, N>([&](auto i_) { return lhs_.Get(i_) / rhs_; });
+	}
+
+	/* Others */
+
+	//
+	T Length() const
+	{ return std::sqrt(LengthSq()); }
+
+	//
+	constexpr T LengthSq() const
+	{ return Dot(*this, std::make_index_sequence<N>{}); }
+
+	//
+	void Swap(Vector& rhs_)
+	{ std::swap(this->m, rhs_.m); }
+
+	// sum of component products, public for VectorDotProduct()
+	template <size_t... Is>
+	constexpr T Dot(const Vector& rhs_, std::index_sequence<Is...>) const
+	{ return ((this->Get(VectorIndex<Is>{}) * rhs_.Get(VectorIndex<Is>{})) + ...); }
+
+private:
+	template <typename U, size_t... Is>
+	constexpr Vector(const Vector<U, N>& rhs_, std::index_sequence<Is...>) :
+	VectorData<T, N>(static_cast<T>(rhs_.Get(VectorIndex<Is>{}))...)
+	{ /* empty by design */ }
+
+	template <size_t... Is>
+	constexpr bool Equal(const Vector& rhs_, std::index_sequence<Is...>) const
+	{
+		return ((-VECTOR_EPSILON<T> <= this->Get(VectorIndex<Is>{}) - rhs_.Get(VectorIndex<Is>{}) &&
+			this->Get(VectorIndex<Is>{}) - rhs_.Get(VectorIndex<Is>{}) <= VECTOR_EPSILON<T>) && ...);
+	}
+};
+
+//
+template <typename T, size_t N>
+constexpr T VectorDotProduct(const Vector<T, N>& vec_0_, const Vector<T, N>& vec_1_)
+{ return vec_0_.Dot(vec_1_, std::make_index_sequence<N>{}); }
+
+//
+template <typename T, size_t N>
+constexpr T VectorSquaredDistance(const Vector<T, N>& vec_0_, const Vector<T, N>& vec_1_)
+{ return (vec_0_ - vec_1_).LengthSq(); }
+
+//
+template <typename T, size_t N>
+T VectorDistance(const Vector<T, N>& vec_0_, const Vector<T, N>& vec_1_)
+{ return (vec_0_ - vec_1_).Length(); }
+
+//
+template <typename T, size_t N>
+Vector<T, N> VectorNormalize(const Vector<T, N>& vec_)
+{
+	const T magnitude = vec_.Length();
+	if (-VECTOR_EPSILON<T> <= magnitude && magnitude <= VECTOR_EPSILON<T>)
+	{ throw "Division by 0 in VectorNormalize()"; }
+	return vec_ * (static_cast<T>(1) / magnitude);
+}
+
+//
+template <typename T>
+constexpr Vector<T, 3> VectorCrossProduct(const Vector<T, 3>& vec_0_, const Vector<T, 3>& vec_1_)
+{ return { vec_0_.y * vec_1_.z - vec_0_.z * vec_1_.y, vec_0_.z * vec_1_.x - vec_0_.x * vec_1_.z, vec_0_.x * vec_1_.y - vec_0_.y * vec_1_.x }; }
+
+#endif // VECTOR_H_
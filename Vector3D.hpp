@@ -3,104 +3,73 @@
 #ifndef VECTOR3D_H_
 #define VECTOR3D_H_
 
-//
-typedef union Vector3D
-{
-	// some warning about a nameless struct
-	// but it's way more convenient this way :(
-	struct
-	{ float x, y, z; };
-
-	float m[3]{};
-
-	/* Constructors */
-
-	//
-	Vector3D() = default;
-
-	//
-	Vector3D(float x_, float y_, float z_);
-
-	/* Assignment Operators */
-
-	//
-	Vector3D& operator=(const Vector3D& rhs_);
-
-	//
-	Vector3D& operator+=(const Vector3D& rhs_);
-
-	//
-	Vector3D& operator-=(const Vector3D& rhs_);
-
-	//
-	Vector3D& operator*=(float rhs_);
-
-	//
-	Vector3D& operator/=(float rhs_);
-
-	/* Unary Operators */
-
-	//
-	Vector3D operator-() const;
-
-	/* Comparison Operators */
+#include "SIMD.hpp" // SIMDInvSqrtFast()
+#include "Vector.hpp"
+#include <cmath> // sqrtf()
 
-	//
-	bool operator==(const Vector3D& rhs_) const;
+// everything here is inline so the collision hot loops can fold it
+constexpr float VEC3_EPSILON = 0.0001f;
 
-	/* Others */
+// x, y, z view of Vector<float, 3>, see Vector.hpp for the members and operators
+using Vector3D = Vector<float, 3>;
+using Vec3 = Vector3D;
+using Point3D = Vector3D;
+using Pt3 = Vector3D;
 
-	//
-	float Length() const;
-
-	//
-	float LengthSq() const;
-
-	//
-	void Swap(Vector3D& rhs_);
-
-} Vector3D, Vec3, Point3D, Pt3;
-
-//
-Vector3D operator+(const Vector3D& lhs_, const Vector3D& rhs_);
-
-//
-Vector3D operator-(const Vector3D& lhs_, const Vector3D& rhs_);
+// double precision for large-world coordinates
+using Vector3Dd = Vector<double, 3>;
+using Vec3d = Vector3Dd;
 
 //
-Vector3D operator*(const Vector3D& lhs_, float rhs_);
-
-//
-Vector3D operator*(float lhs_, const Vector3D& rhs_);
-
-//
-Vector3D operator/(const Vector3D& lhs_, float rhs_);
-
-//
-Vector3D Vector3DNormalize(const Vector3D& vec_);
+inline Vector3D Vector3DNormalize(const Vector3D& vec_)
+{
+	const float magnitude = vec_.Length();
+	if (-VEC3_EPSILON <= magnitude && magnitude <= VEC3_EPSILON)
+	{ throw "Division by 0 in Vector3DNormalize()"; }
+	return { vec_.x / magnitude, vec_.y / magnitude, vec_.z / magnitude };
+}
+
+// rsqrt + one Newton-Raphson step instead of sqrt and divide,
+// within 3.0e-7 of Vector3DNormalize(), the error of SIMDInvSqrtFast()
+inline Vector3D Vector3DNormalizeFast(const Vector3D& vec_)
+{
+	const float magnitude_sq = vec_.LengthSq();
+	if (magnitude_sq <= VEC3_EPSILON * VEC3_EPSILON)
+	{ throw "Division by 0 in Vector3DNormalizeFast()"; }
+	const float inv_magnitude = SIMDInvSqrtFast(magnitude_sq);
+	return { vec_.x * inv_magnitude, vec_.y * inv_magnitude, vec_.z * inv_magnitude };
+}
 
 //
-float Vector3DDistance(const Vector3D& vec_0_, const Vector3D& vec_1_);
+constexpr float Vector3DSquaredDistance(const Vector3D& vec_0_, const Vector3D& vec_1_)
+{ return (vec_0_.x - vec_1_.x) * (vec_0_.x - vec_1_.x) + (vec_0_.y - vec_1_.y) * (vec_0_.y - vec_1_.y) + (vec_0_.z - vec_1_.z) * (vec_0_.z - vec_1_.z); }
 
 //
-float Vector3DSquaredDistance(const Vector3D& vec_0_, const Vector3D& vec_1_);
+inline float Vector3DDistance(const Vector3D& vec_0_, const Vector3D& vec_1_)
+{ return sqrtf(Vector3DSquaredDistance(vec_0_, vec_1_)); }
 
 //
-float Vector3DDotProduct(const Vector3D& vec_0_, const Vector3D& vec_1_);
+constexpr float Vector3DDotProduct(const Vector3D& vec_0_, const Vector3D& vec_1_)
+{ return vec_0_.x * vec_1_.x + vec_0_.y * vec_1_.y + vec_0_.z * vec_1_.z; }
 
 //
-float Vector3DCrossProductMag(const Vector3D& vec_0_, const Vector3D& vec_1_);
+constexpr Vector3D Vector3DCrossProduct(const Vector3D& vec_0_, const Vector3D& vec_1_)
+{ return { vec_0_.y * vec_1_.z - vec_0_.z * vec_1_.y, vec_0_.z * vec_1_.x - vec_0_.x * vec_1_.z, vec_0_.x * vec_1_.y - vec_0_.y * vec_1_.x }; }
 
 //
-Vector3D Vector3DCrossProduct(const Vector3D& vec_0_, const Vector3D& vec_1_);
+inline float Vector3DCrossProductMag(const Vector3D& vec_0_, const Vector3D& vec_1_)
+{ return Vector3DCrossProduct(vec_0_, vec_1_).Length(); }
 
 //
-float Vector3DProjLength(const Vector3D& base_, const Vector3D& vec_);
+inline float Vector3DProjLength(const Vector3D& base_, const Vector3D& vec_)
+{ return Vector3DDotProduct(Vector3DNormalize(base_), vec_); }
 
 //
-Vector3D Vector3DProj(const Vector3D& base_, const Vector3D& vec_);
+inline Vector3D Vector3DProj(const Vector3D& base_, const Vector3D& vec_)
+{ return Vector3DProjLength(base_, vec_) * Vector3DNormalize(base_); }
 
 //
-Vector3D Vector3DPerpProj(const Vector3D& base_, const Vector3D& vec_);
+inline Vector3D Vector3DPerpProj(const Vector3D& base_, const Vector3D& vec_)
+{ return vec_ - Vector3DProj(base_, vec_); }
 
 #endif // VECTOR3D_H_